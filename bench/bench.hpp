@@ -0,0 +1,262 @@
+//-----------------------------------------------------------------------------
+//  cppstringx benchmarks
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    //-------------------------------------------------------------------------
+    // do_not_optimize
+    //-------------------------------------------------------------------------
+    // Every benchmarked function returns a value derived from its result, the values are accumulated here,
+    // so that the compiler cannot remove the measured code.
+
+    inline volatile size_t& result_sink()
+    {
+        static volatile size_t sink = 0;
+        return sink;
+    }
+
+    inline void do_not_optimize(size_t value)
+    {
+        result_sink() = result_sink() + value;
+    }
+
+    //-------------------------------------------------------------------------
+    // result
+    //-------------------------------------------------------------------------
+
+    // One measured combination of function family, implementation, character type, text kind and input size.
+    struct result
+    {
+        std::string family; // The function family, e.g. contains.
+        std::string implementation; // cppstringx or a baseline, e.g. std_search.
+        std::string char_type; // char, wchar_t, char16_t or char32_t.
+        std::string text_kind; // string, c_string or range.
+        std::string size_class; // short, medium or huge.
+        size_t code_units; // The number of code units of the input text.
+        size_t iterations; // The number of calls measured.
+        double ns_per_op; // The mean time per call in nanoseconds.
+        double mb_per_s; // The input bytes processed per second in MB (10^6 bytes).
+
+        // The key used for filtering and for finding the result in a baseline file.
+        std::string name() const
+        {
+            return family + "/" + implementation + "/" + char_type + "/" + text_kind + "/" + size_class;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    // runner
+    //-------------------------------------------------------------------------
+
+    // Runs the benchmarks selected on the command line and reports the results.
+    // Options:
+    //   --filter=<text>           Runs only benchmarks whose name contains <text>, e.g. --filter=contains/ or --filter=/char16_t/.
+    //   --min-time=<ms>           The minimum measuring time per benchmark in milliseconds, default 50.
+    //   --json=<file>             Writes the results as JSON, one benchmark object per line.
+    //   --baseline=<file>         Compares the results with a JSON file written by --json before.
+    //   --max-regression=<pct>    The accepted slowdown compared to the baseline in percent, default 10. Larger slowdowns set the exit code to 1.
+    //   --list                    Prints the benchmark names without running them.
+    class runner
+    {
+    public:
+        runner(int argc, char** argv)
+            : filter()
+            , json_file()
+            , baseline_file()
+            , min_time_ms(50.0)
+            , max_regression_percent(10.0)
+            , list_only(false)
+            , results()
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                const std::string argument(argv[i]);
+                std::string value;
+                if (option_value(argument, "--filter=", value))
+                {
+                    filter = value;
+                }
+                else if (option_value(argument, "--json=", value))
+                {
+                    json_file = value;
+                }
+                else if (option_value(argument, "--baseline=", value))
+                {
+                    baseline_file = value;
+                }
+                else if (option_value(argument, "--min-time=", value))
+                {
+                    min_time_ms = std::atof(value.c_str());
+                }
+                else if (option_value(argument, "--max-regression=", value))
+                {
+                    max_regression_percent = std::atof(value.c_str());
+                }
+                else if (argument == "--list")
+                {
+                    list_only = true;
+                }
+                else
+                {
+                    std::cerr << "Unknown option " << argument << std::endl;
+                }
+            }
+        }
+
+        // Measures a function returning a size_t value derived from its result.
+        // The function is called repeatedly, the number of calls is doubled until the minimum measuring time is reached.
+        template <typename function_type>
+        void run(const result& description, size_t input_bytes, const function_type& function)
+        {
+            result measured = description;
+            const std::string name = measured.name();
+            if (name.find(filter) == std::string::npos)
+            {
+                return;
+            }
+            if (list_only)
+            {
+                std::cout << name << std::endl;
+                return;
+            }
+            do_not_optimize(function()); // Warm up caches and lazily initialized tables.
+            size_t iterations = 1;
+            double elapsed_ns = 0.0;
+            while (true)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < iterations; ++i)
+                {
+                    do_not_optimize(function());
+                }
+                const auto stop = std::chrono::steady_clock::now();
+                elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+                if (elapsed_ns >= min_time_ms * 1e6 || iterations >= (static_cast<size_t>(1) << 40))
+                {
+                    break;
+                }
+                iterations *= 2;
+            }
+            measured.iterations = iterations;
+            measured.ns_per_op = elapsed_ns / static_cast<double>(iterations);
+            measured.mb_per_s = measured.ns_per_op > 0.0 ? static_cast<double>(input_bytes) * 1e3 / measured.ns_per_op : 0.0;
+            std::cout << std::left << std::setw(64) << name << std::right << std::setw(16) << std::fixed << std::setprecision(1) << measured.ns_per_op << " ns"
+                << std::setw(12) << std::setprecision(1) << measured.mb_per_s << " MB/s" << std::endl;
+            results.push_back(measured);
+        }
+
+        // Writes the JSON file and compares with the baseline, returns the exit code.
+        int finish() const
+        {
+            if (!json_file.empty())
+            {
+                write_json(json_file);
+            }
+            int exit_code = 0;
+            if (!baseline_file.empty())
+            {
+                exit_code = compare_with_baseline(baseline_file);
+            }
+            return exit_code;
+        }
+
+    private:
+        static bool option_value(const std::string& argument, const std::string& option, std::string& value)
+        {
+            if (argument.compare(0, option.size(), option) != 0)
+            {
+                return false;
+            }
+            value = argument.substr(option.size());
+            return true;
+        }
+
+        void write_json(const std::string& file_name) const
+        {
+            std::ofstream output(file_name.c_str());
+            output << "{\n\"context\": {\"cplusplus\": " << __cplusplus << ", \"min_time_ms\": " << min_time_ms << "},\n\"benchmarks\": [\n";
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const result& item = results[i];
+                output << "{\"name\": \"" << item.name() << "\", \"family\": \"" << item.family << "\", \"implementation\": \"" << item.implementation
+                    << "\", \"char_type\": \"" << item.char_type << "\", \"text_kind\": \"" << item.text_kind << "\", \"size_class\": \"" << item.size_class
+                    << "\", \"code_units\": " << item.code_units << ", \"iterations\": " << item.iterations
+                    << ", \"ns_per_op\": " << std::setprecision(6) << std::fixed << item.ns_per_op << ", \"mb_per_s\": " << item.mb_per_s << "}"
+                    << (i + 1 < results.size() ? ",\n" : "\n");
+            }
+            output << "]\n}\n";
+        }
+
+        // Reads the name and ns_per_op values of the benchmark lines written by write_json.
+        static std::map<std::string, double> read_baseline(const std::string& file_name)
+        {
+            std::map<std::string, double> baseline;
+            std::ifstream input(file_name.c_str());
+            std::string line;
+            const std::string name_key = "\"name\": \"";
+            const std::string time_key = "\"ns_per_op\": ";
+            while (std::getline(input, line))
+            {
+                const size_t name_position = line.find(name_key);
+                const size_t time_position = line.find(time_key);
+                if (name_position == std::string::npos || time_position == std::string::npos)
+                {
+                    continue;
+                }
+                const size_t name_begin = name_position + name_key.size();
+                const std::string name = line.substr(name_begin, line.find('"', name_begin) - name_begin);
+                baseline[name] = std::atof(line.c_str() + time_position + time_key.size());
+            }
+            return baseline;
+        }
+
+        int compare_with_baseline(const std::string& file_name) const
+        {
+            const std::map<std::string, double> baseline = read_baseline(file_name);
+            if (baseline.empty())
+            {
+                std::cerr << "No benchmarks found in baseline " << file_name << std::endl;
+                return 1;
+            }
+            size_t regressions = 0;
+            std::cout << "\nComparison with " << file_name << " (accepted slowdown " << max_regression_percent << "%):" << std::endl;
+            for (const result& item : results)
+            {
+                const auto it = baseline.find(item.name());
+                if (it == baseline.end() || it->second <= 0.0)
+                {
+                    continue;
+                }
+                const double change_percent = (item.ns_per_op / it->second - 1.0) * 100.0;
+                const bool is_regression = change_percent > max_regression_percent;
+                regressions += is_regression ? 1 : 0;
+                std::cout << std::left << std::setw(64) << item.name() << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                    << change_percent << "%" << (is_regression ? "  REGRESSION" : "") << std::endl;
+            }
+            std::cout << regressions << " regression(s)" << std::endl;
+            return regressions > 0 ? 1 : 0;
+        }
+
+        std::string filter; // Selects the benchmarks by name.
+        std::string json_file; // The file the results are written to.
+        std::string baseline_file; // The file the results are compared with.
+        double min_time_ms; // The minimum measuring time per benchmark.
+        double max_regression_percent; // The accepted slowdown compared to the baseline.
+        bool list_only; // Prints the names only.
+        std::vector<result> results; // The measured benchmarks.
+    };
+
+} //bench namespace
@@ -0,0 +1,443 @@
+//-----------------------------------------------------------------------------
+//  cppstringx benchmarks
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+// Measures the public function families of cppstringx for all code unit types, text kinds and input sizes,
+// and compares them with the C++ Standard Library and hand-written loops.
+// Run e.g. cppstringx_bench --filter=contains/ --json=results.json
+// and later cppstringx_bench --filter=contains/ --baseline=results.json to find regressions.
+
+#include <cppstringx/cppstringx.hpp>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "corpus.hpp"
+
+#if defined(__cpp_lib_boyer_moore_searcher)
+#define CPPSTRINGX_BENCH_BOYER_MOORE_SEARCHER
+#endif
+
+namespace
+{
+    //-------------------------------------------------------------------------
+    // inputs
+    //-------------------------------------------------------------------------
+
+    // The texts and patterns used by the benchmarks for one code unit type and size.
+    template <typename char_type>
+    struct inputs
+    {
+        typedef std::basic_string<char_type> string_type;
+
+        explicit inputs(size_t code_units)
+            : text(bench::widen<char_type>(bench::make_prose(code_units)))
+            , text_copy(text)
+            , text_upper(cppstringx::to_upper_copy(text, cppstringx::utility::ascii_case()))
+            , csv(bench::widen<char_type>(bench::make_csv(code_units)))
+            , pattern(bench::widen<char_type>(bench::needle()))
+            , prefix(text.substr(0, 24))
+            , suffix(text.substr(text.size() - std::min<size_t>(text.size(), 24)))
+            , missing_a(bench::widen<char_type>("zebra"))
+            , missing_b(bench::widen<char_type>("quartz"))
+            , replace_from(bench::widen<char_type>(" the "))
+            , replace_to(bench::widen<char_type>(" THE "))
+            , comma(bench::widen<char_type>(","))
+            , separators(bench::widen<char_type>(",\n"))
+            , fields()
+            , needle_searcher(pattern)
+        {
+            cppstringx::split_chars(fields, csv, separators);
+        }
+
+        string_type text; // Prose starting and ending with blanks, the pattern is the last word.
+        string_type text_copy; // The same prose in a different buffer.
+        string_type text_upper; // The prose in upper case.
+        string_type csv; // Comma separated lines.
+        string_type pattern; // Found at the end of the text only.
+        string_type prefix; // The start of the text.
+        string_type suffix; // The end of the text.
+        string_type missing_a; // Not part of the text.
+        string_type missing_b; // Not part of the text.
+        string_type replace_from; // Replaced in the text.
+        string_type replace_to; // The replacement.
+        string_type comma; // The CSV field separator.
+        string_type separators; // The CSV field and line separators.
+        std::vector<string_type> fields; // The CSV fields.
+        cppstringx::searcher<char_type> needle_searcher; // Precompiled pattern.
+    };
+
+    // Checks for blanks without a locale, is_space uses std::ctype which is not available for all code unit types.
+    struct is_blank
+    {
+        template <typename char_type>
+        bool operator()(char_type value) const
+        {
+            return value == ' ' || value == '\t' || value == '\n' || value == '\r';
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    // cppstringx function families
+    //-------------------------------------------------------------------------
+    // Each operation is called with the text as std::basic_string, null-terminated string, and range object.
+
+    struct equals_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::equals(text, in.text_copy) ? 1 : 0;
+        }
+    };
+
+    struct iequals_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::iequals(text, in.text_upper, cppstringx::utility::ascii_equals_comparer_ignoring_case()) ? 1 : 0;
+        }
+    };
+
+    struct starts_with_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::starts_with(text, in.prefix) ? 1 : 0;
+        }
+    };
+
+    struct ends_with_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::ends_with(text, in.suffix) ? 1 : 0;
+        }
+    };
+
+    struct contains_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::contains(text, in.pattern) ? 1 : 0;
+        }
+    };
+
+    struct contains_searcher_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::contains(text, in.needle_searcher) ? 1 : 0;
+        }
+    };
+
+    struct icontains_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::icontains(text, in.pattern, cppstringx::utility::ascii_equals_comparer_ignoring_case()) ? 1 : 0;
+        }
+    };
+
+    struct contains_any_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::contains_any(text, { in.missing_a.c_str(), in.missing_b.c_str(), in.pattern.c_str() }) ? 1 : 0;
+        }
+    };
+
+    struct trim_view_operation
+    {
+        static const bool uses_csv = false;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>&) const
+        {
+            const auto trimmed = cppstringx::trim_view(text, is_blank());
+            return static_cast<size_t>(std::distance(trimmed.begin(), trimmed.end()));
+        }
+    };
+
+    struct count_fields_operation
+    {
+        static const bool uses_csv = true;
+        template <typename text_type, typename char_type>
+        size_t operator()(const text_type& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::count_fields_chars(text, in.separators);
+        }
+
+        template <typename char_type>
+        size_t operator()(const char_type* text, const inputs<char_type>& in) const
+        {
+            const char_type* p_text = text; // The split iterators expect a modifiable pointer variable.
+            return cppstringx::count_fields_chars(p_text, in.separators);
+        }
+    };
+
+    // The following operations create string objects, they are measured for std::basic_string only.
+
+    struct trim_copy_operation
+    {
+        static const bool uses_csv = false;
+        template <typename char_type>
+        size_t operator()(const std::basic_string<char_type>& text, const inputs<char_type>&) const
+        {
+            return cppstringx::trim_copy(text, is_blank()).size();
+        }
+    };
+
+    struct to_lower_copy_operation
+    {
+        static const bool uses_csv = false;
+        template <typename char_type>
+        size_t operator()(const std::basic_string<char_type>& text, const inputs<char_type>&) const
+        {
+            return cppstringx::to_lower_copy(text, cppstringx::utility::ascii_case()).size();
+        }
+    };
+
+    struct replace_all_copy_operation
+    {
+        static const bool uses_csv = false;
+        template <typename char_type>
+        size_t operator()(const std::basic_string<char_type>& text, const inputs<char_type>& in) const
+        {
+            return cppstringx::replace_all_copy(text, in.replace_from, in.replace_to).size();
+        }
+    };
+
+    struct split_token_operation
+    {
+        static const bool uses_csv = true;
+        template <typename char_type>
+        size_t operator()(const std::basic_string<char_type>& text, const inputs<char_type>& in) const
+        {
+            std::vector<std::basic_string<char_type>> container;
+            cppstringx::split_token(container, text, in.comma);
+            return container.size();
+        }
+    };
+
+    struct join_operation
+    {
+        static const bool uses_csv = true;
+        template <typename char_type>
+        size_t operator()(const std::basic_string<char_type>&, const inputs<char_type>& in) const
+        {
+            std::basic_string<char_type> target;
+            cppstringx::join(target, in.fields, in.comma);
+            return target.size();
+        }
+    };
+
+    //-------------------------------------------------------------------------
+    // baselines
+    //-------------------------------------------------------------------------
+
+    template <typename char_type>
+    size_t hand_written_find(const std::basic_string<char_type>& text, const std::basic_string<char_type>& pattern)
+    {
+        const size_t pattern_size = pattern.size();
+        for (size_t i = 0; i + pattern_size <= text.size(); ++i)
+        {
+            size_t j = 0;
+            while (j < pattern_size && text[i + j] == pattern[j])
+            {
+                ++j;
+            }
+            if (j == pattern_size)
+            {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    template <typename char_type>
+    char_type ascii_lower(char_type value)
+    {
+        return value >= 'A' && value <= 'Z' ? static_cast<char_type>(value - 'A' + 'a') : value;
+    }
+
+    //-------------------------------------------------------------------------
+    // registration
+    //-------------------------------------------------------------------------
+
+    template <typename char_type>
+    bench::result describe(const char* family, const char* implementation, const char* text_kind, const char* size_name, size_t code_units)
+    {
+        bench::result result = { family, implementation, bench::char_type_name<char_type>::value(), text_kind, size_name, code_units, 0, 0.0, 0.0 };
+        return result;
+    }
+
+    // Runs a cppstringx operation for std::basic_string.
+    template <typename char_type, typename operation_type>
+    void run_string_kind(bench::runner& runner, const char* family, const char* size_name, const inputs<char_type>& in, const operation_type& operation)
+    {
+        const std::basic_string<char_type>& text = operation_type::uses_csv ? in.csv : in.text;
+        runner.run(describe<char_type>(family, "cppstringx", "string", size_name, text.size()), text.size() * sizeof(char_type), [&]() { return operation(text, in); });
+    }
+
+    // Runs a cppstringx operation for std::basic_string, null-terminated strings and range objects.
+    template <typename char_type, typename operation_type>
+    void run_text_kinds(bench::runner& runner, const char* family, const char* size_name, const inputs<char_type>& in, const operation_type& operation)
+    {
+        run_string_kind(runner, family, size_name, in, operation);
+        const std::basic_string<char_type>& text = operation_type::uses_csv ? in.csv : in.text;
+        const size_t bytes = text.size() * sizeof(char_type);
+        const char_type* p_text = text.c_str();
+        const cppstringx::range<const char_type*> text_range(text.data(), text.data() + text.size());
+        runner.run(describe<char_type>(family, "cppstringx", "c_string", size_name, text.size()), bytes, [&]() { return operation(p_text, in); });
+        runner.run(describe<char_type>(family, "cppstringx", "range", size_name, text.size()), bytes, [&]() { return operation(text_range, in); });
+    }
+
+    // Runs a baseline using std::basic_string.
+    template <typename char_type, typename function_type>
+    void run_baseline(bench::runner& runner, const char* family, const char* implementation, const char* size_name, const std::basic_string<char_type>& text, const function_type& function)
+    {
+        runner.run(describe<char_type>(family, implementation, "string", size_name, text.size()), text.size() * sizeof(char_type), function);
+    }
+
+    template <typename char_type>
+    void run_char_type(bench::runner& runner)
+    {
+        for (const bench::size_class& size : bench::size_classes())
+        {
+            const inputs<char_type> in(size.code_units);
+            const std::basic_string<char_type>& text = in.text;
+            const char* size_name = size.name;
+
+            const char_type* p_text = text.c_str();
+            runner.run(describe<char_type>("string_length", "cppstringx", "c_string", size_name, text.size()), text.size() * sizeof(char_type), [&]() { return cppstringx::string_length(p_text); });
+            runner.run(describe<char_type>("string_length", "char_traits_length", "c_string", size_name, text.size()), text.size() * sizeof(char_type), [&]() { return std::char_traits<char_type>::length(p_text); });
+
+            run_text_kinds(runner, "equals", size_name, in, equals_operation());
+            run_baseline(runner, "equals", "operator_equal", size_name, text, [&]() { return text == in.text_copy ? size_t(1) : size_t(0); });
+
+            run_text_kinds(runner, "iequals", size_name, in, iequals_operation());
+            run_baseline(runner, "iequals", "hand_written_loop", size_name, text, [&]()
+            {
+                if (text.size() != in.text_upper.size())
+                {
+                    return size_t(0);
+                }
+                for (size_t i = 0; i < text.size(); ++i)
+                {
+                    if (ascii_lower(text[i]) != ascii_lower(in.text_upper[i]))
+                    {
+                        return size_t(0);
+                    }
+                }
+                return size_t(1);
+            });
+
+            run_text_kinds(runner, "starts_with", size_name, in, starts_with_operation());
+            run_baseline(runner, "starts_with", "std_compare", size_name, text, [&]() { return text.compare(0, in.prefix.size(), in.prefix) == 0 ? size_t(1) : size_t(0); });
+
+            run_text_kinds(runner, "ends_with", size_name, in, ends_with_operation());
+            run_baseline(runner, "ends_with", "std_compare", size_name, text, [&]() { return text.compare(text.size() - in.suffix.size(), in.suffix.size(), in.suffix) == 0 ? size_t(1) : size_t(0); });
+
+            run_text_kinds(runner, "contains", size_name, in, contains_operation());
+            run_text_kinds(runner, "contains_searcher", size_name, in, contains_searcher_operation());
+            run_baseline(runner, "contains", "std_string_find", size_name, text, [&]() { return text.find(in.pattern) != std::basic_string<char_type>::npos ? size_t(1) : size_t(0); });
+            run_baseline(runner, "contains", "std_search", size_name, text, [&]() { return std::search(text.begin(), text.end(), in.pattern.begin(), in.pattern.end()) != text.end() ? size_t(1) : size_t(0); });
+#if defined(CPPSTRINGX_BENCH_BOYER_MOORE_SEARCHER)
+            const std::boyer_moore_horspool_searcher<typename std::basic_string<char_type>::const_iterator> horspool(in.pattern.begin(), in.pattern.end());
+            run_baseline(runner, "contains", "std_boyer_moore_horspool", size_name, text, [&]() { return std::search(text.begin(), text.end(), horspool) != text.end() ? size_t(1) : size_t(0); });
+#endif
+            run_baseline(runner, "contains", "hand_written_loop", size_name, text, [&]() { return hand_written_find(text, in.pattern); });
+
+            run_text_kinds(runner, "icontains", size_name, in, icontains_operation());
+            run_text_kinds(runner, "contains_any", size_name, in, contains_any_operation());
+
+            run_text_kinds(runner, "trim_view", size_name, in, trim_view_operation());
+            run_string_kind(runner, "trim_copy", size_name, in, trim_copy_operation());
+            run_baseline(runner, "trim_copy", "std_find_not_of", size_name, text, [&]()
+            {
+                static const char_type blanks[] = { ' ', '\t', '\n', '\r', 0 };
+                const size_t first = text.find_first_not_of(blanks);
+                return first == std::basic_string<char_type>::npos ? size_t(0) : text.substr(first, text.find_last_not_of(blanks) - first + 1).size();
+            });
+
+            run_string_kind(runner, "to_lower_copy", size_name, in, to_lower_copy_operation());
+            run_baseline(runner, "to_lower_copy", "std_transform", size_name, text, [&]()
+            {
+                std::basic_string<char_type> result(text.size(), char_type());
+                std::transform(text.begin(), text.end(), result.begin(), ascii_lower<char_type>);
+                return result.size();
+            });
+
+            run_string_kind(runner, "replace_all_copy", size_name, in, replace_all_copy_operation());
+            run_baseline(runner, "replace_all_copy", "std_string_find", size_name, text, [&]()
+            {
+                std::basic_string<char_type> result;
+                size_t position = 0;
+                for (size_t found = text.find(in.replace_from); found != std::basic_string<char_type>::npos; found = text.find(in.replace_from, position))
+                {
+                    result.append(text, position, found - position);
+                    result += in.replace_to;
+                    position = found + in.replace_from.size();
+                }
+                result.append(text, position, std::basic_string<char_type>::npos);
+                return result.size();
+            });
+
+            run_text_kinds(runner, "count_fields", size_name, in, count_fields_operation());
+            run_string_kind(runner, "split_token", size_name, in, split_token_operation());
+            run_baseline(runner, "split_token", "std_string_find", size_name, in.csv, [&]()
+            {
+                std::vector<std::basic_string<char_type>> container;
+                size_t position = 0;
+                for (size_t found = in.csv.find(in.comma); found != std::basic_string<char_type>::npos; found = in.csv.find(in.comma, position))
+                {
+                    container.push_back(in.csv.substr(position, found - position));
+                    position = found + in.comma.size();
+                }
+                container.push_back(in.csv.substr(position));
+                return container.size();
+            });
+
+            run_string_kind(runner, "join", size_name, in, join_operation());
+            run_baseline(runner, "join", "hand_written_loop", size_name, in.csv, [&]()
+            {
+                std::basic_string<char_type> target;
+                for (size_t i = 0; i < in.fields.size(); ++i)
+                {
+                    if (i > 0)
+                    {
+                        target += in.comma;
+                    }
+                    target += in.fields[i];
+                }
+                return target.size();
+            });
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench::runner runner(argc, argv);
+    run_char_type<char>(runner);
+    run_char_type<wchar_t>(runner);
+    run_char_type<char16_t>(runner);
+    run_char_type<char32_t>(runner);
+    return runner.finish();
+}
@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+//  cppstringx benchmarks
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    //-------------------------------------------------------------------------
+    // corpus
+    //-------------------------------------------------------------------------
+    // The texts are generated from a fixed seed, so that the results of different builds are comparable.
+
+    // The input sizes in code units.
+    struct size_class
+    {
+        const char* name;
+        size_t code_units;
+    };
+
+    inline std::vector<size_class> size_classes()
+    {
+        std::vector<size_class> result;
+        size_class short_text = { "short", 32 };
+        size_class medium_text = { "medium", 4096 };
+        size_class huge_text = { "huge", 4 * 1024 * 1024 };
+        result.push_back(short_text);
+        result.push_back(medium_text);
+        result.push_back(huge_text);
+        return result;
+    }
+
+    // The pattern searched by the contains benchmarks. It is not part of the word list and appended at the end of the text,
+    // so that a search reads the whole text.
+    inline const char* needle()
+    {
+        return "xylophone";
+    }
+
+    // Creates English-like ASCII prose: words of typical length, capitalized sentence starts, punctuation, and line breaks.
+    // Leading and trailing blanks are added for the trim benchmarks, the needle is the last word.
+    inline std::string make_prose(size_t code_units)
+    {
+        static const char* const words[] = {
+            "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on", "not", "he", "this", "are", "or",
+            "string", "search", "pattern", "memory", "vector", "buffer", "request", "header", "Content-Length", "value", "field", "record",
+            "performance", "implementation", "allocation", "character", "encoding", "separator", "iterator", "container", "library"
+        };
+        const size_t word_count = sizeof(words) / sizeof(words[0]);
+        std::mt19937 random(2022);
+        std::uniform_int_distribution<size_t> word_index(0, word_count - 1);
+        std::uniform_int_distribution<int> punctuation(0, 15);
+        const std::string ending = std::string(" ") + needle() + "  \n";
+        std::string result = "  ";
+        bool sentence_start = true;
+        while (result.size() + ending.size() < code_units)
+        {
+            std::string word = words[word_index(random)];
+            if (sentence_start)
+            {
+                word[0] = static_cast<char>(word[0] >= 'a' && word[0] <= 'z' ? word[0] - 'a' + 'A' : word[0]);
+                sentence_start = false;
+            }
+            result += word;
+            const int mark = punctuation(random);
+            if (mark == 0)
+            {
+                result += ".\n";
+                sentence_start = true;
+            }
+            else if (mark == 1)
+            {
+                result += ", ";
+            }
+            else
+            {
+                result += ' ';
+            }
+        }
+        result.resize(code_units > ending.size() ? code_units - ending.size() : 0, ' ');
+        result += ending;
+        result.resize(code_units);
+        return result;
+    }
+
+    // Creates comma separated lines with short fields.
+    inline std::string make_csv(size_t code_units)
+    {
+        std::mt19937 random(1977);
+        std::uniform_int_distribution<int> number(0, 99999);
+        static const char* const cities[] = { "Zurich", "Berlin", "Lisbon", "Oslo", "Rome", "Vienna" };
+        std::string result;
+        size_t id = 0;
+        while (result.size() < code_units)
+        {
+            ++id;
+            result += std::to_string(id) + ",user" + std::to_string(number(random)) + "," + cities[id % 6] + "," + std::to_string(number(random)) + "\n";
+        }
+        result.resize(code_units);
+        return result;
+    }
+
+    // Converts an ASCII string to another code unit type.
+    template <typename char_type>
+    inline std::basic_string<char_type> widen(const std::string& text)
+    {
+        std::basic_string<char_type> result;
+        result.reserve(text.size());
+        for (char value : text)
+        {
+            result.push_back(static_cast<char_type>(static_cast<unsigned char>(value)));
+        }
+        return result;
+    }
+
+    // The name of a code unit type used in the benchmark names.
+    template <typename char_type>
+    struct char_type_name;
+    template <>
+    struct char_type_name<char>
+    {
+        static const char* value() { return "char"; }
+    };
+    template <>
+    struct char_type_name<wchar_t>
+    {
+        static const char* value() { return "wchar_t"; }
+    };
+    template <>
+    struct char_type_name<char16_t>
+    {
+        static const char* value() { return "char16_t"; }
+    };
+    template <>
+    struct char_type_name<char32_t>
+    {
+        static const char* value() { return "char32_t"; }
+    };
+
+} //bench namespace
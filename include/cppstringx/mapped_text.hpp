@@ -0,0 +1,367 @@
+// cppstringx - C++ String Extensions
+// Link: https://github.com/squeakycode/cppstringx
+// Version: 1.0.0
+// Minimum required C++ Standard: C++11
+// License: BSD 3-Clause License
+// 
+// Copyright (c) 2022, Andreas Gau
+// 
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+\file
+\brief Contains utility::mapped_text, which maps a file into memory, so that its content can be used as text by the cppstringx functions.
+The class is declared in this separate header, so that the operating system headers are only included by code using it.
+*/
+
+#pragma once
+
+#include "cppstringx.hpp"
+#include <string>
+#include <cassert>
+
+//Operating system functions used for mapping files into memory, see utility::mapped_text.
+#include <system_error>
+#if defined(_WIN32)
+#define CPPSTRINGX_MAPPED_TEXT_WINDOWS
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#include <windows.h>
+#undef NOMINMAX
+#else
+#include <windows.h>
+#endif
+#elif defined(__unix__) || defined(__APPLE__)
+#define CPPSTRINGX_MAPPED_TEXT_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#if defined(CPPSTRINGX_MAPPED_TEXT_WINDOWS) || defined(CPPSTRINGX_MAPPED_TEXT_POSIX)
+namespace cppstringx
+{
+    namespace utility
+    {
+        //-------------------------------------------------------------------------
+        // mapped_text
+        //-------------------------------------------------------------------------
+
+        /**
+            \brief Used to tell the operating system how the code units of a mapped_text are going to be accessed.
+        */
+        enum class access_hint
+        {
+            normal = 0, //!< No special access pattern.
+            sequential = 1, //!< The text is read from the start to the end, e.g. when splitting a file into lines. Pages are read ahead and may be dropped after reading.
+            random = 2 //!< The text is accessed at random positions, reading ahead is not useful.
+        };
+
+        /**
+            \brief Maps a file into memory, so that its content can be used as text without copying it into a string.
+            The text is provided as range<const char*> which can be passed to all functions and iterators accepting a string object,
+            e.g. make_split_chars_iterator(), make_split_token_iterator(), contains(), or trim_copy().
+            The file is mapped read-only using mmap on POSIX systems and CreateFileMapping on Windows.
+            mapped_text is declared in cppstringx/mapped_text.hpp, so that only code including this header includes the operating system headers.
+            \note The ranges into the text are valid until the mapped_text is destroyed. The file must not be truncated while it is mapped.
+
+            Example:
+            \code
+            cppstringx::utility::mapped_text file("server.log", cppstringx::utility::access_hint::sequential);
+            auto text = file.text();
+            auto split_it = cppstringx::make_split_token_iterator(text, "\n");
+            while (!split_it.is_end_position())
+            {
+                if (cppstringx::contains(*split_it, "ERROR"))
+                {
+                    //...
+                }
+                ++split_it;
+            }
+            \endcode
+        */
+        class mapped_text
+        {
+        public:
+            typedef const char* iterator_type; //!< The type of the iterator for the range containing the text.
+
+            /**
+                \brief Maps a file into memory.
+                \param[in] file_name    The name of the file to map.
+                \param[in] hint         Tells the operating system how the text is going to be accessed.
+                \throw std::system_error if the file cannot be opened or mapped.
+            */
+            explicit mapped_text(const char* file_name, access_hint hint = access_hint::normal)
+                : p_data(nullptr)
+                , data_size(0)
+            {
+                assert(file_name);
+                map_file(file_name, hint);
+            }
+
+            /**
+                \brief Maps a file into memory.
+                \param[in] file_name    The name of the file to map.
+                \param[in] hint         Tells the operating system how the text is going to be accessed.
+                \throw std::system_error if the file cannot be opened or mapped.
+            */
+            explicit mapped_text(const std::string& file_name, access_hint hint = access_hint::normal)
+                : mapped_text(file_name.c_str(), hint)
+            {
+            }
+
+#if defined(CPPSTRINGX_MAPPED_TEXT_WINDOWS)
+            /**
+                \brief Maps a file into memory. The file name is passed to the wide character version of the Windows API,
+                so that file names not representable in the ANSI code page can be used.
+                \param[in] file_name    The name of the file to map.
+                \param[in] hint         Tells the operating system how the text is going to be accessed.
+                \throw std::system_error if the file cannot be opened or mapped.
+            */
+            explicit mapped_text(const wchar_t* file_name, access_hint hint = access_hint::normal)
+                : p_data(nullptr)
+                , data_size(0)
+            {
+                assert(file_name);
+                map_file(file_name, hint);
+            }
+
+            /**
+                \brief Maps a file into memory. The file name is passed to the wide character version of the Windows API,
+                so that file names not representable in the ANSI code page can be used.
+                \param[in] file_name    The name of the file to map.
+                \param[in] hint         Tells the operating system how the text is going to be accessed.
+                \throw std::system_error if the file cannot be opened or mapped.
+            */
+            explicit mapped_text(const std::wstring& file_name, access_hint hint = access_hint::normal)
+                : mapped_text(file_name.c_str(), hint)
+            {
+            }
+#endif
+
+            mapped_text(const mapped_text&) = delete; // The mapping is owned by a single object.
+            mapped_text& operator=(const mapped_text&) = delete;
+
+            /**
+                \brief Move constructor, the ranges into the text stay valid.
+                \param[in] other    The moved mapped_text, it is empty afterwards.
+            */
+            mapped_text(mapped_text&& other)
+                : p_data(other.p_data)
+                , data_size(other.data_size)
+            {
+                other.p_data = nullptr;
+                other.data_size = 0;
+            }
+
+            /**
+                \brief Move assignment operator, unmaps the current file.
+                \param[in] other    The moved mapped_text, it is empty afterwards.
+                \return Returns a reference to itself.
+            */
+            mapped_text& operator=(mapped_text&& other)
+            {
+                if (this != &other)
+                {
+                    unmap_file();
+                    p_data = other.p_data;
+                    data_size = other.data_size;
+                    other.p_data = nullptr;
+                    other.data_size = 0;
+                }
+                return *this;
+            }
+
+            /**
+                \brief Unmaps the file.
+            */
+            ~mapped_text()
+            {
+                unmap_file();
+            }
+
+            /**
+                \brief The content of the file.
+                \return Returns a range containing the content of the file. The range is empty if the file is empty.
+            */
+            range<iterator_type> text() const
+            {
+                if (p_data == nullptr)
+                {
+                    static const char empty_text[] = "";
+                    return range<iterator_type>(empty_text, empty_text);
+                }
+                return range<iterator_type>(p_data, p_data + data_size);
+            }
+
+            /**
+                \brief The start of the content of the file.
+                \return Returns a pointer to the first code unit, nullptr if the file is empty.
+            */
+            const char* data() const
+            {
+                return p_data;
+            }
+
+            /**
+                \brief The size of the file.
+                \return Returns the number of code units of the file.
+            */
+            size_t size() const
+            {
+                return data_size;
+            }
+
+            /**
+                \brief Checks whether the file is empty.
+                \return Returns true if the file is empty.
+            */
+            bool empty() const
+            {
+                return data_size == 0;
+            }
+
+        private:
+#if defined(CPPSTRINGX_MAPPED_TEXT_WINDOWS)
+            static DWORD get_file_flags(access_hint hint)
+            {
+                return hint == access_hint::sequential ? FILE_FLAG_SEQUENTIAL_SCAN : (hint == access_hint::random ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL);
+            }
+
+            void map_file(const char* file_name, access_hint hint)
+            {
+                map_opened_file(::CreateFileA(file_name, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, get_file_flags(hint), nullptr));
+            }
+
+            void map_file(const wchar_t* file_name, access_hint hint)
+            {
+                map_opened_file(::CreateFileW(file_name, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, get_file_flags(hint), nullptr));
+            }
+
+            void map_opened_file(HANDLE file)
+            {
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(), "The file for the mapped_text cannot be opened.");
+                }
+                LARGE_INTEGER file_size;
+                if (!::GetFileSizeEx(file, &file_size))
+                {
+                    const DWORD error = ::GetLastError();
+                    ::CloseHandle(file);
+                    throw std::system_error(static_cast<int>(error), std::system_category(), "The size of the file for the mapped_text cannot be determined.");
+                }
+                if (file_size.QuadPart > 0)
+                {
+                    // The view keeps the mapping alive, so both handles can be closed after mapping the view.
+                    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    const void* p_view = mapping != nullptr ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+                    const DWORD error = ::GetLastError();
+                    if (mapping != nullptr)
+                    {
+                        ::CloseHandle(mapping);
+                    }
+                    ::CloseHandle(file);
+                    if (p_view == nullptr)
+                    {
+                        throw std::system_error(static_cast<int>(error), std::system_category(), "The file for the mapped_text cannot be mapped.");
+                    }
+                    p_data = static_cast<const char*>(p_view);
+                    data_size = static_cast<size_t>(file_size.QuadPart);
+                }
+                else
+                {
+                    ::CloseHandle(file);
+                }
+            }
+
+            void unmap_file()
+            {
+                if (p_data != nullptr)
+                {
+                    ::UnmapViewOfFile(p_data);
+                }
+            }
+#else
+            void map_file(const char* file_name, access_hint hint)
+            {
+                const int file = ::open(file_name, O_RDONLY);
+                if (file == -1)
+                {
+                    throw std::system_error(errno, std::system_category(), "The file for the mapped_text cannot be opened.");
+                }
+                struct stat file_status;
+                if (::fstat(file, &file_status) == -1)
+                {
+                    const int error = errno;
+                    ::close(file);
+                    throw std::system_error(error, std::system_category(), "The size of the file for the mapped_text cannot be determined.");
+                }
+                if (file_status.st_size > 0)
+                {
+                    // The mapping stays valid after closing the file.
+                    const size_t file_size = static_cast<size_t>(file_status.st_size);
+                    void* p_view = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+                    const int error = errno;
+                    ::close(file);
+                    if (p_view == MAP_FAILED)
+                    {
+                        throw std::system_error(error, std::system_category(), "The file for the mapped_text cannot be mapped.");
+                    }
+                    if (hint != access_hint::normal)
+                    {
+                        // The hint is only an optimization, an error is ignored.
+                        ::madvise(p_view, file_size, hint == access_hint::sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+                    }
+                    p_data = static_cast<const char*>(p_view);
+                    data_size = file_size;
+                }
+                else
+                {
+                    ::close(file);
+                }
+            }
+
+            void unmap_file()
+            {
+                if (p_data != nullptr)
+                {
+                    ::munmap(const_cast<char*>(p_data), data_size);
+                }
+            }
+#endif
+
+        private:
+            const char* p_data; // The start of the mapped file, nullptr if no file is mapped or the file is empty.
+            size_t data_size; // The size of the mapped file.
+        };
+
+    } // utility namespace
+
+} //namespace cppstringx
+#endif
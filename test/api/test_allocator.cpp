@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <memory>
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define TEST_CPPSTRINGX_PMR
+#endif
+#endif
+
+namespace
+{
+    // Counts the allocations, it cannot be default constructed so that a missing allocator does not compile.
+    template <typename T>
+    struct counting_allocator
+    {
+        typedef T value_type;
+
+        explicit counting_allocator(size_t* p_allocation_count)
+            : p_count(p_allocation_count)
+        {
+        }
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>& other)
+            : p_count(other.p_count)
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            ++*p_count;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, size_t n)
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        size_t* p_count;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const counting_allocator<T>& a, const counting_allocator<U>& b)
+    {
+        return a.p_count == b.p_count;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const counting_allocator<T>& a, const counting_allocator<U>& b)
+    {
+        return a.p_count != b.p_count;
+    }
+
+    typedef std::basic_string<char, std::char_traits<char>, counting_allocator<char>> counted_string;
+}
+
+TEST_CASE("allocator copy functions", "[allocator]")
+{
+    size_t allocation_count = 0;
+    const counting_allocator<char> allocator(&allocation_count);
+    const counted_string text("   A text that is longer than the small string buffer   ", allocator);
+    allocation_count = 0;
+
+    counted_string result = cppstringx::copy<counted_string>(std::allocator_arg, allocator, "A text that is longer than the small string buffer");
+    CHECK(result == "A text that is longer than the small string buffer");
+    CHECK(allocation_count > 0);
+
+    allocation_count = 0;
+    result = cppstringx::trim_copy(std::allocator_arg, allocator, text);
+    CHECK(result == "A text that is longer than the small string buffer");
+    CHECK(allocation_count == 1);
+    CHECK(cppstringx::trim_copy(std::allocator_arg, allocator, text, cppstringx::utility::char_class(" A")) == "text that is longer than the small string buffer");
+    CHECK(cppstringx::trim_start_copy(std::allocator_arg, allocator, text) == "A text that is longer than the small string buffer   ");
+    CHECK(cppstringx::trim_start_copy(std::allocator_arg, allocator, text, cppstringx::utility::is_space()) == "A text that is longer than the small string buffer   ");
+    CHECK(cppstringx::trim_end_copy(std::allocator_arg, allocator, text) == "   A text that is longer than the small string buffer");
+    CHECK(cppstringx::trim_end_copy(std::allocator_arg, allocator, text, cppstringx::utility::is_space()) == "   A text that is longer than the small string buffer");
+    CHECK(cppstringx::trim_copy(std::allocator_arg, allocator, counted_string("   ", allocator)).empty());
+
+    allocation_count = 0;
+    CHECK(cppstringx::to_lower_copy(std::allocator_arg, allocator, text) == "   a text that is longer than the small string buffer   ");
+    CHECK(allocation_count == 1);
+    CHECK(cppstringx::to_lower_copy(std::allocator_arg, allocator, text, cppstringx::utility::ascii_case()) == "   a text that is longer than the small string buffer   ");
+    CHECK(cppstringx::to_upper_copy(std::allocator_arg, allocator, text) == "   A TEXT THAT IS LONGER THAN THE SMALL STRING BUFFER   ");
+    CHECK(cppstringx::to_upper_copy(std::allocator_arg, allocator, text, cppstringx::utility::latin1_case()) == "   A TEXT THAT IS LONGER THAN THE SMALL STRING BUFFER   ");
+
+    allocation_count = 0;
+    CHECK(cppstringx::replace_all_copy(std::allocator_arg, allocator, text, "longer", "shorter") == "   A text that is shorter than the small string buffer   ");
+    CHECK(allocation_count == 1);
+    CHECK(cppstringx::replace_all_copy(std::allocator_arg, allocator, text, "LONGER", "shorter", cppstringx::utility::equals_comparer_ignoring_case())
+        == "   A text that is shorter than the small string buffer   ");
+    CHECK_THROWS_AS(cppstringx::replace_all_copy(std::allocator_arg, allocator, text, "", "x"), std::invalid_argument);
+}
+
+TEST_CASE("allocator split functions", "[allocator]")
+{
+    size_t allocation_count = 0;
+    const counting_allocator<char> allocator(&allocation_count);
+    const std::string text("first field that does not fit the small string buffer,,second field that does not fit the small string buffer");
+    std::vector<counted_string> container;
+    container.reserve(8);
+
+    cppstringx::split_chars(std::allocator_arg, allocator, container, text, ",");
+    REQUIRE(container.size() == 3);
+    CHECK(container[0] == "first field that does not fit the small string buffer");
+    CHECK(container[1].empty());
+    CHECK(allocation_count == 2);
+    CHECK(container[2].get_allocator() == allocator);
+
+    cppstringx::split(std::allocator_arg, allocator, container, text, cppstringx::utility::is_any_of<const char*>(","), cppstringx::split_mode::skip_empty);
+    CHECK(container.size() == 2);
+
+    allocation_count = 0;
+    cppstringx::split_token(std::allocator_arg, allocator, container, text, ",,");
+    REQUIRE(container.size() == 2);
+    CHECK(container[1] == "second field that does not fit the small string buffer");
+    CHECK(allocation_count == 2);
+    cppstringx::split_token(std::allocator_arg, allocator, container, text, "FIELD", cppstringx::split_mode::all, cppstringx::utility::equals_comparer_ignoring_case(), false);
+    CHECK(container.size() == 5);
+
+    // elements not using an allocator
+    std::vector<cppstringx::range<std::string::const_iterator>> ranges;
+    cppstringx::split_token(std::allocator_arg, allocator, ranges, text, ",,");
+    REQUIRE(ranges.size() == 2);
+    CHECK(cppstringx::equals(ranges[0], "first field that does not fit the small string buffer"));
+}
+
+#if defined(TEST_CPPSTRINGX_PMR)
+TEST_CASE("allocator pmr", "[allocator]")
+{
+    char buffer[8192];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    const std::pmr::string text("  A text that is longer than the small string buffer  ", &arena);
+    std::pmr::string trimmed = cppstringx::trim_copy(std::allocator_arg, &arena, text);
+    CHECK(trimmed == "A text that is longer than the small string buffer");
+    CHECK(trimmed.get_allocator().resource() == &arena);
+    CHECK(cppstringx::replace_all_copy(std::allocator_arg, &arena, text, "longer", "shorter").get_allocator().resource() == &arena);
+    CHECK(cppstringx::copy<std::pmr::string>(std::allocator_arg, &arena, text).get_allocator().resource() == &arena);
+
+    // the std::pmr::vector passes its memory resource to the elements
+    std::pmr::vector<std::pmr::string> container(&arena);
+    cppstringx::split_chars(container, text, " ", cppstringx::split_mode::skip_empty);
+    REQUIRE(container.size() == 10);
+    CHECK(container[0].get_allocator().resource() == &arena);
+}
+#endif
@@ -0,0 +1,154 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <vector>
+#include <random>
+#include <cppstringx/cppstringx.hpp>
+
+TEST_CASE("test string_batch", "[batch]")
+{
+    std::vector<std::string> strings = { "Hello", "", " World " };
+    cppstringx::string_batch<char> batch(strings);
+    REQUIRE(batch.size() == 3);
+    CHECK_FALSE(batch.empty());
+    CHECK(batch.length(0) == 5);
+    CHECK(batch.length(1) == 0);
+    CHECK(cppstringx::equals(batch[2], " World "));
+    CHECK(cppstringx::equals(batch.all_code_units(), "Hello World "));
+    batch.push_back(u"Wide");
+    CHECK(cppstringx::equals(batch[3], "Wide"));
+    std::vector<std::string> copied;
+    batch.copy_to(copied);
+    CHECK(copied == std::vector<std::string>({ "Hello", "", " World ", "Wide" }));
+    batch.clear();
+    CHECK(batch.empty());
+    CHECK(batch.all_code_units().begin() == batch.all_code_units().end());
+}
+
+TEST_CASE("test batch case conversion and trimming", "[batch]")
+{
+    std::vector<std::string> strings = { " Select", "FROM ", "  ", "wHeRe" };
+    cppstringx::string_batch<char> batch(strings);
+    cppstringx::to_lower_in_place_batch(strings, cppstringx::utility::ascii_case());
+    cppstringx::trim_in_place_batch(strings);
+    CHECK(strings == std::vector<std::string>({ "select", "from", "", "where" }));
+    cppstringx::trim_in_place_batch(batch);
+    cppstringx::to_lower_in_place_batch(batch, cppstringx::utility::ascii_case());
+    std::vector<std::string> copied;
+    CHECK(batch.copy_to(copied) == strings);
+    cppstringx::to_upper_in_place_batch(batch);
+    CHECK(cppstringx::equals(batch[3], "WHERE"));
+    cppstringx::to_lower_in_place_batch(batch);
+    CHECK(cppstringx::equals(batch[0], "select"));
+    cppstringx::trim_in_place_batch(batch, [](char c) { return c == 's' || c == 'e'; });
+    CHECK(cppstringx::equals(batch[0], "lect"));
+    CHECK(cppstringx::equals(batch[3], "wher"));
+    std::vector<std::wstring> wide_strings = { L" A ", L"b" };
+    cppstringx::to_upper_in_place_batch(wide_strings, cppstringx::utility::latin1_case());
+    cppstringx::trim_in_place_batch(wide_strings, [](wchar_t c) { return c == L' '; });
+    CHECK(wide_strings == std::vector<std::wstring>({ L"A", L"B" }));
+}
+
+TEST_CASE("test batch comparisons", "[batch]")
+{
+    std::vector<std::string> strings = { "Content-Length", "content-type", "CONTENT-LENGTH", "content", "" };
+    cppstringx::string_batch<char> batch(strings);
+    std::vector<bool> matches;
+    CHECK(cppstringx::iequals_batch(strings, "content-length", matches) == 2);
+    CHECK(matches == std::vector<bool>({ true, false, true, false, false }));
+    CHECK(cppstringx::iequals_batch(batch, "content-length", matches, cppstringx::utility::ascii_equals_comparer_ignoring_case()) == 2);
+    CHECK(matches == std::vector<bool>({ true, false, true, false, false }));
+    CHECK(cppstringx::equals_batch(batch, "content", matches) == 1);
+    CHECK(matches[3]);
+    CHECK(cppstringx::equals_batch(batch, std::string(), matches) == 1);
+    CHECK(matches[4]);
+    CHECK(cppstringx::starts_with_batch(strings, "content", matches) == 2);
+    CHECK(matches == std::vector<bool>({ false, true, false, true, false }));
+    CHECK(cppstringx::starts_with_batch(batch, "CONTENT-", matches, cppstringx::utility::ascii_equals_comparer_ignoring_case()) == 3);
+    CHECK(matches == std::vector<bool>({ true, true, true, false, false }));
+    std::vector<const char*> c_strings = { "a", "ab", "b" };
+    CHECK(cppstringx::starts_with_batch(c_strings, "a", matches) == 2);
+}
+
+TEST_CASE("test batch comparisons comparing code points", "[batch]")
+{
+    // The Kelvin sign is 3 bytes long and equals "k" ignoring case.
+    std::vector<std::string> strings = { "k", "K", "\xE2\x84\xAA", "\xE2\x84\xAA" "ey", "x" };
+    cppstringx::string_batch<char> batch(strings);
+    const cppstringx::utility::unicode_equals_comparer_ignoring_case comparer;
+    std::vector<bool> vector_matches;
+    std::vector<bool> batch_matches;
+    CHECK(cppstringx::equals_batch(strings, "k", vector_matches, comparer) == 3);
+    CHECK(cppstringx::equals_batch(batch, "k", batch_matches, comparer) == 3);
+    CHECK(vector_matches == std::vector<bool>({ true, true, true, false, false }));
+    CHECK(batch_matches == vector_matches);
+    CHECK(cppstringx::starts_with_batch(strings, "ke", vector_matches, comparer) == 1);
+    CHECK(cppstringx::starts_with_batch(batch, "ke", batch_matches, comparer) == 1);
+    CHECK(vector_matches == std::vector<bool>({ false, false, false, true, false }));
+    CHECK(batch_matches == vector_matches);
+    CHECK(cppstringx::equals_batch(batch, "\xE2\x84\xAA", batch_matches, comparer) == 3);
+}
+
+TEST_CASE("test batch compared to single string functions", "[batch]")
+{
+    std::mt19937 random(17);
+    std::uniform_int_distribution<size_t> length(0, 40);
+    std::uniform_int_distribution<size_t> letter(0, 4);
+    std::vector<std::string> strings;
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string text;
+        const size_t text_length = length(random) / (i % 3 + 1);
+        for (size_t j = 0; j < text_length; ++j)
+        {
+            text += "aAbB "[letter(random)];
+        }
+        strings.push_back(text);
+    }
+    cppstringx::string_batch<char> batch(strings);
+    cppstringx::string_batch<char> parallel_batch(strings);
+    cppstringx::trim_in_place_batch(batch);
+    cppstringx::to_lower_in_place_batch(batch, cppstringx::utility::ascii_case());
+    cppstringx::trim_in_place_batch(parallel_batch);
+    cppstringx::to_lower_in_place_batch(cppstringx::utility::parallel_policy(4, 64), parallel_batch, cppstringx::utility::ascii_case());
+    std::vector<bool> equals_matches;
+    std::vector<bool> prefix_matches;
+    const size_t equals_count = cppstringx::iequals_batch(batch, "ab", equals_matches);
+    const size_t prefix_count = cppstringx::starts_with_batch(batch, "ab", prefix_matches);
+    size_t expected_equals_count = 0;
+    size_t expected_prefix_count = 0;
+    for (size_t i = 0; i < strings.size(); ++i)
+    {
+        const std::string expected = cppstringx::to_lower_copy(cppstringx::trim_copy(strings[i]), cppstringx::utility::ascii_case());
+        CHECK(cppstringx::equals(batch[i], expected));
+        CHECK(cppstringx::equals(parallel_batch[i], expected));
+        const bool expected_equals = cppstringx::iequals(expected, "ab");
+        const bool expected_prefix = cppstringx::starts_with(expected, "ab");
+        CHECK(equals_matches[i] == expected_equals);
+        CHECK(prefix_matches[i] == expected_prefix);
+        expected_equals_count += expected_equals ? 1 : 0;
+        expected_prefix_count += expected_prefix ? 1 : 0;
+    }
+    CHECK(equals_count == expected_equals_count);
+    CHECK(prefix_count == expected_prefix_count);
+}
+
+TEST_CASE("test parallel batch case conversion of code points", "[batch]")
+{
+    std::vector<std::string> strings(2000, "AA\xC3\x84\xC3\x96");
+    std::vector<std::u16string> wide_strings(2000, u"a\U0001E922\u00E4");
+    for (size_t thread_count = 1; thread_count <= 16; ++thread_count)
+    {
+        cppstringx::string_batch<char> batch(strings);
+        cppstringx::to_lower_in_place_batch(cppstringx::utility::parallel_policy(thread_count, 1), batch, cppstringx::utility::unicode_case());
+        cppstringx::string_batch<char16_t> wide_batch(wide_strings);
+        cppstringx::to_upper_in_place_batch(cppstringx::utility::parallel_policy(thread_count, 1), wide_batch, cppstringx::utility::unicode_case());
+        for (size_t i = 0; i < strings.size(); ++i)
+        {
+            CHECK(cppstringx::equals(batch[i], "aa\xC3\xA4\xC3\xB6"));
+            CHECK(cppstringx::equals(wide_batch[i], cppstringx::to_upper_copy(wide_strings[i], cppstringx::utility::unicode_case())));
+        }
+    }
+}
@@ -0,0 +1,235 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // A comparer that is equivalent to the default comparer, but uses the code unit by code unit algorithms.
+    struct loop_equals_comparer
+    {
+        template <typename char_type_lhs, typename char_type_rhs>
+        bool operator()(char_type_lhs lhs, char_type_rhs rhs) const
+        {
+            return lhs == rhs;
+        }
+    };
+
+    // A comparer that is equivalent to a case-insensitive comparer, but uses the code unit by code unit algorithms.
+    template <typename equals_comparer_type>
+    struct loop_folding_comparer
+    {
+        template <typename char_type_lhs, typename char_type_rhs>
+        bool operator()(char_type_lhs lhs, char_type_rhs rhs) const
+        {
+            return equals_comparer_type()(lhs, rhs);
+        }
+    };
+
+    template <typename string_type>
+    string_type make_random_string(std::mt19937& generator, size_t size, int alphabet_size, bool allow_null)
+    {
+        std::uniform_int_distribution<int> distribution(allow_null ? 0 : 1, alphabet_size);
+        string_type result;
+        for (size_t i = 0; i < size; ++i)
+        {
+            int value = distribution(generator);
+            result.push_back(static_cast<typename string_type::value_type>(value ? 'a' + value - 1 : 0));
+        }
+        return result;
+    }
+
+    template <typename string_type>
+    void check_against_loop(unsigned int seed, bool allow_null)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<size_t> text_size_distribution(0, 80);
+        std::uniform_int_distribution<size_t> pattern_size_distribution(0, 6);
+        std::uniform_int_distribution<int> alphabet_distribution(1, 3);
+        for (int i = 0; i < 2000; ++i)
+        {
+            int alphabet_size = alphabet_distribution(generator);
+            string_type text = make_random_string<string_type>(generator, text_size_distribution(generator), alphabet_size, allow_null);
+            string_type pattern = make_random_string<string_type>(generator, pattern_size_distribution(generator), alphabet_size, allow_null);
+            if (i % 4 == 0 && pattern.size() <= text.size())
+            {
+                // use a prefix or suffix of the text as pattern
+                pattern = (i % 8 == 0) ? text.substr(0, pattern.size()) : text.substr(text.size() - pattern.size());
+            }
+
+            // string objects
+            CHECK(cppstringx::equals(text, pattern) == cppstringx::equals(text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::starts_with(text, pattern) == cppstringx::starts_with(text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::ends_with(text, pattern) == cppstringx::ends_with(text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::contains(text, pattern) == cppstringx::contains(text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::contains(text, pattern) == (text.find(pattern) != string_type::npos));
+            if (!pattern.empty())
+            {
+                CHECK(cppstringx::replace_all_copy(text, pattern, string_type(2, 'X')) == cppstringx::replace_all_copy(text, pattern, string_type(2, 'X'), loop_equals_comparer()));
+            }
+
+            // null-terminated strings
+            const typename string_type::value_type* p_text = text.c_str();
+            const typename string_type::value_type* p_pattern = pattern.c_str();
+            CHECK(cppstringx::equals(p_text, pattern) == cppstringx::equals(p_text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::equals(text, p_pattern) == cppstringx::equals(text, p_pattern, loop_equals_comparer()));
+            CHECK(cppstringx::equals(p_text, p_pattern) == cppstringx::equals(p_text, p_pattern, loop_equals_comparer()));
+            CHECK(cppstringx::starts_with(p_text, pattern) == cppstringx::starts_with(p_text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::starts_with(text, p_pattern) == cppstringx::starts_with(text, p_pattern, loop_equals_comparer()));
+            CHECK(cppstringx::ends_with(p_text, p_pattern) == cppstringx::ends_with(p_text, p_pattern, loop_equals_comparer()));
+            CHECK(cppstringx::contains(p_text, pattern) == cppstringx::contains(p_text, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::contains(text, p_pattern) == cppstringx::contains(text, p_pattern, loop_equals_comparer()));
+            CHECK(cppstringx::contains(p_text, p_pattern) == cppstringx::contains(p_text, p_pattern, loop_equals_comparer()));
+            if (*p_pattern)
+            {
+                CHECK(cppstringx::replace_all_copy(string_type(p_text), p_pattern, string_type(1, 'Y')) == cppstringx::replace_all_copy(string_type(p_text), p_pattern, string_type(1, 'Y'), loop_equals_comparer()));
+            }
+
+            // range objects
+            cppstringx::range<typename string_type::const_iterator> text_range(text.begin() + static_cast<std::ptrdiff_t>(text.size() / 4), text.end());
+            CHECK(cppstringx::contains(text_range, pattern) == cppstringx::contains(text_range, pattern, loop_equals_comparer()));
+            CHECK(cppstringx::ends_with(text_range, pattern) == cppstringx::ends_with(text_range, pattern, loop_equals_comparer()));
+        }
+    }
+
+    template <typename string_type, typename equals_comparer_type>
+    void check_folding_against_loop(unsigned int seed)
+    {
+        // upper and lower case letters, non-letters next to the letter ranges and Latin 1 letters
+        const unsigned int alphabet[] = { 'a', 'A', 'z', 'Z', '@', '[', '`', '{', 0xC0, 0xE0, 0xDE, 0xFE, 0xD7, 0xF7 };
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<size_t> text_size_distribution(0, 80);
+        std::uniform_int_distribution<size_t> pattern_size_distribution(1, 6);
+        std::uniform_int_distribution<size_t> alphabet_distribution(0, sizeof(alphabet) / sizeof(alphabet[0]) - 1);
+        equals_comparer_type comparer;
+        loop_folding_comparer<equals_comparer_type> loop_comparer;
+        for (int i = 0; i < 2000; ++i)
+        {
+            size_t alphabet_size = 1 + static_cast<size_t>(i) % 4;
+            string_type text(text_size_distribution(generator), 0);
+            string_type pattern(pattern_size_distribution(generator), 0);
+            for (auto& code_unit : text)
+            {
+                code_unit = static_cast<typename string_type::value_type>(alphabet[alphabet_distribution(generator) % (alphabet_size * 2)]);
+            }
+            for (auto& code_unit : pattern)
+            {
+                code_unit = static_cast<typename string_type::value_type>(alphabet[alphabet_distribution(generator) % (alphabet_size * 2)]);
+            }
+            if (i % 4 == 0 && pattern.size() <= text.size())
+            {
+                // use a prefix or suffix of the text as pattern
+                pattern = (i % 8 == 0) ? text.substr(0, pattern.size()) : text.substr(text.size() - pattern.size());
+            }
+
+            CHECK(cppstringx::iequals(text, pattern, comparer) == cppstringx::iequals(text, pattern, loop_comparer));
+            CHECK(cppstringx::iequals(text, text, comparer));
+            CHECK(cppstringx::istarts_with(text, pattern, comparer) == cppstringx::istarts_with(text, pattern, loop_comparer));
+            CHECK(cppstringx::iends_with(text, pattern, comparer) == cppstringx::iends_with(text, pattern, loop_comparer));
+            CHECK(cppstringx::icontains(text, pattern, comparer) == cppstringx::icontains(text, pattern, loop_comparer));
+            CHECK(cppstringx::icontains(text.c_str(), pattern, comparer) == cppstringx::icontains(text.c_str(), pattern, loop_comparer));
+            CHECK(cppstringx::ireplace_all_copy(text, pattern, string_type(2, 'X'), comparer) == cppstringx::ireplace_all_copy(text, pattern, string_type(2, 'X'), loop_comparer));
+        }
+    }
+}
+
+namespace
+{
+    template <typename string_type>
+    void check_char_class_against_loop(unsigned int seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<size_t> text_size_distribution(0, 100);
+        std::uniform_int_distribution<int> code_unit_distribution(0, 255);
+        std::uniform_int_distribution<int> set_code_unit_distribution(0, 7);
+        for (int i = 0; i < 500; ++i)
+        {
+            // The characters of the set are chosen from a small part of the code unit values, to get many matches.
+            int set_offset = code_unit_distribution(generator) & 0xF8;
+            string_type characters;
+            for (size_t count = static_cast<size_t>(i % 5); count > 0; --count)
+            {
+                characters.push_back(static_cast<typename string_type::value_type>(set_offset + set_code_unit_distribution(generator)));
+            }
+            string_type text;
+            for (size_t size = text_size_distribution(generator); size > 0; --size)
+            {
+                int value = (i % 2) ? code_unit_distribution(generator) : set_offset + set_code_unit_distribution(generator) * 2;
+                text.push_back(static_cast<typename string_type::value_type>(value));
+            }
+            cppstringx::utility::char_class char_class_predicate(characters);
+            cppstringx::utility::is_any_of<string_type> is_any_of_predicate(characters);
+
+            std::vector<string_type> expected;
+            std::vector<string_type> container;
+            cppstringx::split(expected, text, is_any_of_predicate);
+            cppstringx::split(container, text, char_class_predicate);
+            CHECK(container == expected);
+            cppstringx::split(expected, text, is_any_of_predicate, cppstringx::split_mode::skip_empty);
+            cppstringx::split_chars(container, text, characters, cppstringx::split_mode::skip_empty);
+            CHECK(container == expected);
+
+            CHECK(cppstringx::trim_copy(text, char_class_predicate) == cppstringx::trim_copy(text, is_any_of_predicate));
+            CHECK(cppstringx::trim_start_copy(text, char_class_predicate) == cppstringx::trim_start_copy(text, is_any_of_predicate));
+            CHECK(cppstringx::trim_end_copy(text, char_class_predicate) == cppstringx::trim_end_copy(text, is_any_of_predicate));
+            string_type text_in_place(text);
+            CHECK(cppstringx::trim_in_place(text_in_place, char_class_predicate) == cppstringx::trim_copy(text, is_any_of_predicate));
+        }
+    }
+}
+
+TEST_CASE("contiguous character class", "[contiguous]")
+{
+    check_char_class_against_loop<std::string>(51);
+    check_char_class_against_loop<std::u16string>(52);
+}
+
+TEST_CASE("contiguous fast path ignoring case", "[contiguous]")
+{
+    cppstringx::utility::ascii_equals_comparer_ignoring_case ascii_comparer;
+    CHECK(cppstringx::iequals(std::string("Content-Length"), "content-length", ascii_comparer));
+    CHECK(cppstringx::iequals(std::string(50, 'A'), std::string(50, 'a'), ascii_comparer));
+    CHECK(!cppstringx::iequals(std::string(50, 'A') + "@", std::string(50, 'a') + "`", ascii_comparer));
+    CHECK(cppstringx::icontains(std::string("SELECT * FROM users WHERE id = 1"), "from USERS", ascii_comparer));
+    CHECK(cppstringx::istarts_with(std::string("Transfer-Encoding: chunked"), "transfer-encoding:", ascii_comparer));
+    CHECK(cppstringx::iends_with(std::string("Transfer-Encoding: chunked"), "CHUNKED", ascii_comparer));
+    CHECK(cppstringx::ireplace_all_copy(std::string("a.Txt, b.TXT"), ".txt", ".md", ascii_comparer) == "a.md, b.md");
+    std::string text("Hello World, hello world");
+    CHECK(cppstringx::ireplace_all_in_place(text, "HELLO", "Bye", ascii_comparer) == "Bye World, Bye world");
+    CHECK(!cppstringx::iequals(std::string("\xC0"), "\xE0", ascii_comparer));
+
+    cppstringx::utility::latin1_equals_comparer_ignoring_case latin1_comparer;
+    CHECK(cppstringx::iequals(std::string("\xC0\xC9\xDE"), "\xE0\xE9\xFE", latin1_comparer));
+    CHECK(cppstringx::icontains(std::u16string(u"STRA\u00DFE M\u00DCNCHEN"), u"m\u00fcnchen", latin1_comparer));
+
+    check_folding_against_loop<std::string, cppstringx::utility::ascii_equals_comparer_ignoring_case>(47);
+    check_folding_against_loop<std::string, cppstringx::utility::latin1_equals_comparer_ignoring_case>(48);
+    check_folding_against_loop<std::u16string, cppstringx::utility::ascii_equals_comparer_ignoring_case>(49);
+    check_folding_against_loop<std::u32string, cppstringx::utility::latin1_equals_comparer_ignoring_case>(50);
+}
+
+TEST_CASE("contiguous fast path", "[contiguous]")
+{
+    CHECK(cppstringx::contains(std::string("Hello World, hello world, hello World!"), "llo World!"));
+    CHECK(cppstringx::contains(std::string(100, 'a') + "b", std::string(20, 'a') + "b"));
+    CHECK(!cppstringx::contains(std::string(100, 'a'), std::string(20, 'a') + "b"));
+    CHECK(cppstringx::contains(std::string("abc\0def", 7), std::string("c\0d", 3)));
+    CHECK(!cppstringx::contains("abc", std::string("c\0", 2)));
+    CHECK(!cppstringx::starts_with("ab", std::string("ab\0", 3)));
+    CHECK(!cppstringx::equals("ab", std::string("ab\0", 3)));
+    CHECK(cppstringx::equals(std::string("ab\0", 3), std::string("ab\0", 3)));
+    CHECK(cppstringx::ends_with(std::u32string(U"Hello World"), U"World"));
+    CHECK(cppstringx::starts_with(std::u16string(u"Hello World"), u"Hello"));
+    CHECK(cppstringx::contains(std::wstring(L"Hello World"), L"o W"));
+    CHECK(cppstringx::replace_all_copy(std::string(64, 'a'), "aa", "b") == std::string(32, 'b'));
+
+    check_against_loop<std::string>(42, true);
+    check_against_loop<std::string>(43, false);
+    check_against_loop<std::wstring>(44, false);
+    check_against_loop<std::u16string>(45, true);
+    check_against_loop<std::u32string>(46, false);
+}
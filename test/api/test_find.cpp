@@ -0,0 +1,177 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    typedef cppstringx::utility::ascii_equals_comparer_ignoring_case ascii_comparer;
+
+    // Returns the positions of the non-overlapping matches found by std::string::find.
+    std::vector<size_t> find_all_reference(const std::string& text, const std::string& pattern)
+    {
+        std::vector<size_t> result;
+        for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + pattern.size()))
+        {
+            result.push_back(position);
+        }
+        return result;
+    }
+}
+
+TEST_CASE("test find_first and find_last", "[find]")
+{
+    const std::string text("key=value=other");
+    auto first = cppstringx::find_first(text, "=");
+    CHECK(first.begin() - text.begin() == 3);
+    CHECK(first.end() - text.begin() == 4);
+    auto last = cppstringx::find_last(text, "=");
+    CHECK(last.begin() - text.begin() == 9);
+    CHECK(std::string(last.end(), text.cend()) == "other");
+
+    // Not found and empty patterns
+    CHECK(cppstringx::find_first(text, "#").begin() == text.end());
+    CHECK(cppstringx::find_first(text, "#").end() == text.end());
+    CHECK(cppstringx::find_last(text, "#").begin() == text.end());
+    CHECK(cppstringx::find_first(text, "").begin() == text.begin());
+    CHECK(cppstringx::find_last(text, "").begin() == text.end());
+    const std::string empty_text;
+    CHECK(cppstringx::find_first(empty_text, "a").end() == empty_text.end());
+    CHECK(cppstringx::find_last(empty_text, "a").end() == empty_text.end());
+
+    // Null-terminated strings, ranges and lists
+    const char* p_text = "a.b.c";
+    CHECK(cppstringx::find_first(p_text, ".").begin() == p_text + 1);
+    CHECK(cppstringx::find_last(p_text, ".").begin() == p_text + 3);
+    CHECK(cppstringx::find_first(p_text, "x").begin() == p_text + 5);
+    const std::list<char> list_text(text.begin(), text.end());
+    CHECK(std::distance(list_text.begin(), cppstringx::find_first(list_text, "value").begin()) == 4);
+    CHECK(std::distance(list_text.begin(), cppstringx::find_last(list_text, std::string("=")).begin()) == 9);
+
+    // Comparers, searchers and literal patterns
+    const std::string path("C:\\Temp\\Report.TXT.txt");
+    CHECK(cppstringx::find_first(path, ".txt", ascii_comparer()).begin() - path.begin() == 14);
+    CHECK(cppstringx::find_last(path, ".TXT", ascii_comparer()).begin() - path.begin() == 18);
+    const cppstringx::searcher<char, ascii_comparer> txt(".Txt");
+    CHECK(cppstringx::find_first(path, txt).begin() - path.begin() == 14);
+    CHECK(cppstringx::find_last(path, txt).begin() - path.begin() == 18);
+    CHECK(cppstringx::find_last(path, cppstringx::make_literal_pattern("\\")).begin() - path.begin() == 7);
+    const std::string api_path("/API/v2/api/x");
+    CHECK(cppstringx::find_first(api_path, cppstringx::make_literal_pattern("api"), ascii_comparer()).begin() - api_path.begin() == 1);
+    CHECK(cppstringx::find_last(api_path, cppstringx::make_literal_pattern("API"), ascii_comparer()).begin() - api_path.begin() == 8);
+    CHECK(cppstringx::find_last(api_path, cppstringx::make_literal_pattern("API")).begin() - api_path.begin() == 1);
+    const std::u16string wide(u"x\u00E9y\u00E9");
+    CHECK(cppstringx::find_last(wide, u"\u00E9").begin() - wide.begin() == 3);
+
+    // Code point comparers search backwards code point by code point.
+    const cppstringx::utility::unicode_equals_comparer_ignoring_case unicode_comparer;
+    const std::string accented("x\xC3\x89x\xC3\x89y");
+    CHECK(cppstringx::find_first(accented, "\xC3\xA9", unicode_comparer).begin() - accented.begin() == 1);
+    CHECK(cppstringx::find_last(accented, "\xC3\xA9", unicode_comparer).begin() - accented.begin() == 4);
+    CHECK(cppstringx::find_last(accented, "\xC3\xA9", unicode_comparer).end() - accented.begin() == 6);
+    const std::string kelvin("ab\xE2\x84\xAA" "c");
+    CHECK(cppstringx::find_first(kelvin, "k", unicode_comparer).begin() - kelvin.begin() == 2);
+    CHECK(cppstringx::find_last(kelvin, "K", unicode_comparer).begin() - kelvin.begin() == 2);
+    CHECK(cppstringx::find_last(kelvin, "K", unicode_comparer).end() - kelvin.begin() == 5);
+    const std::list<char> kelvin_list(kelvin.begin(), kelvin.end());
+    CHECK(std::distance(kelvin_list.begin(), cppstringx::find_last(kelvin_list, "kC", unicode_comparer).begin()) == 2);
+}
+
+TEST_CASE("test count", "[find]")
+{
+    CHECK(cppstringx::count(std::string("a-b-c"), "-") == 2);
+    CHECK(cppstringx::count("line\nline\nline", "\n") == 2);
+    CHECK(cppstringx::count(std::string("aaaa"), "aa") == 2); // no overlapping matches
+    CHECK(cppstringx::count(std::string("Error error ERROR"), "error", ascii_comparer()) == 3);
+    CHECK(cppstringx::count(std::string("Error error ERROR"), "error") == 1);
+    CHECK(cppstringx::count(std::string(), "x") == 0);
+    CHECK(cppstringx::count(std::list<char>({ 'a', 'b', 'a', 'b' }), "ab") == 2);
+    const cppstringx::searcher<char> separator("\r\n");
+    CHECK(cppstringx::count(std::string("a\r\nb\r\n\r\n"), separator) == 3);
+    CHECK_THROWS_AS(cppstringx::count(std::string("abc"), ""), std::invalid_argument);
+}
+
+TEST_CASE("test find_iterator", "[find]")
+{
+    std::string text("one, two, three");
+    auto find_it = cppstringx::make_find_iterator(text, ", ");
+    REQUIRE_FALSE(find_it.is_end_position());
+    CHECK(find_it->begin() - text.begin() == 3);
+    CHECK(std::string(find_it->begin(), find_it->end()) == ", ");
+    ++find_it;
+    REQUIRE_FALSE(find_it.is_end_position());
+    CHECK((*find_it).begin() - text.begin() == 8);
+    find_it++;
+    CHECK(find_it.is_end_position());
+    CHECK_FALSE(find_it.advance(1));
+
+    // Resuming at a position, e.g. from a copy of the iterator.
+    auto first = cppstringx::make_find_iterator(text, ", ");
+    const auto resume_position = first.get_resume_position();
+    CHECK(resume_position - text.begin() == 5);
+    CHECK(find_it.resume_at(resume_position));
+    CHECK(find_it->begin() - text.begin() == 8);
+    CHECK(find_it.resume_at(text.begin()));
+    CHECK(find_it->begin() - text.begin() == 3);
+    CHECK_FALSE(find_it.resume_at(text.begin() + 9));
+    CHECK(find_it.is_end_position());
+
+    auto ignoring_case = cppstringx::make_find_iterator(text, "O", ascii_comparer());
+    CHECK(ignoring_case->begin() == text.begin());
+    CHECK(ignoring_case.advance(1));
+    CHECK(ignoring_case->begin() - text.begin() == 7);
+    CHECK_FALSE(ignoring_case.advance(1));
+
+    const char* p_text = "a;b;;c";
+    auto null_terminated_it = cppstringx::make_find_iterator(p_text, ";");
+    CHECK(null_terminated_it.advance(2));
+    CHECK(null_terminated_it->begin() == p_text + 4);
+
+    std::string empty_text;
+    CHECK(cppstringx::make_find_iterator(empty_text, "x").is_end_position());
+    CHECK(cppstringx::find_iterator<std::string, std::string, cppstringx::utility::equals_comparer>().is_end_position());
+    CHECK_THROWS_AS(cppstringx::make_find_iterator(text, ""), std::invalid_argument);
+}
+
+TEST_CASE("test find agrees with std::string::find", "[find]")
+{
+    std::mt19937 random(29);
+    std::uniform_int_distribution<int> letter(0, 2);
+    std::uniform_int_distribution<size_t> length(0, 120);
+    std::uniform_int_distribution<size_t> pattern_length(1, 4);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string text(length(random), 'a');
+        for (char& value : text)
+        {
+            value = static_cast<char>('a' + letter(random));
+        }
+        std::string pattern(pattern_length(random), 'a');
+        for (char& value : pattern)
+        {
+            value = static_cast<char>('a' + letter(random));
+        }
+        const std::vector<size_t> expected = find_all_reference(text, pattern);
+        std::vector<size_t> found;
+        for (auto find_it = cppstringx::make_find_iterator(text, pattern); !find_it.is_end_position(); ++find_it)
+        {
+            found.push_back(static_cast<size_t>(find_it->begin() - text.begin()));
+        }
+        CHECK(found == expected);
+        CHECK(cppstringx::count(text, pattern) == expected.size());
+        CHECK(cppstringx::count(std::list<char>(text.begin(), text.end()), pattern) == expected.size());
+        const size_t first = static_cast<size_t>(cppstringx::find_first(text, pattern).begin() - text.begin());
+        const size_t last = static_cast<size_t>(cppstringx::find_last(text, pattern).begin() - text.begin());
+        CHECK(first == std::min(text.find(pattern), text.size()));
+        CHECK(last == (text.rfind(pattern) == std::string::npos ? text.size() : text.rfind(pattern)));
+        const cppstringx::searcher<char> pattern_searcher(pattern);
+        CHECK(static_cast<size_t>(cppstringx::find_first(text, pattern_searcher).begin() - text.begin()) == first);
+    }
+}
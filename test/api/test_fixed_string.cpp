@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+TEST_CASE("test fixed_string", "[fixed_string]")
+{
+    cppstringx::fixed_string<8> text("abc");
+    CHECK(text.size() == 3);
+    CHECK(text.capacity() == 8);
+    CHECK(std::string(text.c_str()) == "abc");
+    text.push_back('d');
+    text.append("efgh", 4);
+    CHECK(cppstringx::equals(text, "abcdefgh"));
+    CHECK(text.c_str()[8] == '\0');
+    CHECK_THROWS_AS(text.push_back('i'), std::length_error);
+    CHECK_THROWS_AS(text.reserve(9), std::length_error);
+    CHECK(cppstringx::equals(text, "abcdefgh"));
+    text.resize(2);
+    CHECK(std::string(text.c_str()) == "ab");
+    text.pop_back();
+    CHECK(text.length() == 1);
+    text.clear();
+    CHECK(text.empty());
+    CHECK_THROWS_AS((cppstringx::fixed_string<4>("abcde")), std::length_error);
+
+    // Code units are appended from all kinds of iterators.
+    const std::list<char> list = { 'x', 'y', 'z' };
+    cppstringx::fixed_string<3> copied(list.begin(), list.end());
+    CHECK(cppstringx::equals(copied, "xyz"));
+    CHECK_THROWS_AS(copied.append(list.begin(), list.end()), std::length_error);
+    cppstringx::fixed_string<3> assigned;
+    assigned = copied;
+    CHECK(std::string(assigned.rbegin(), assigned.rend()) == "zyx");
+    cppstringx::fixed_string<3> empty;
+    assigned.swap(empty);
+    CHECK(assigned.empty());
+    CHECK(cppstringx::equals(empty, "xyz"));
+
+    // A failed append does not change the text, a failed copy leaves a null-terminated part of it.
+    cppstringx::fixed_string<4> partial("ab");
+    CHECK_THROWS_AS(partial.append(list.begin(), list.end()), std::length_error);
+    CHECK(partial.size() == 2);
+    CHECK(std::string(partial.c_str()) == "ab");
+    CHECK_THROWS_AS(partial.append("xyz", 3), std::length_error);
+    CHECK(std::string(partial.c_str()) == "ab");
+    CHECK_THROWS_AS(cppstringx::copy(partial, std::string("xyz"), false), std::length_error);
+    CHECK(partial.size() == 4);
+    CHECK(std::string(partial.c_str()) == "abxy");
+}
+
+TEST_CASE("test fixed_string as string object", "[fixed_string]")
+{
+    typedef cppstringx::fixed_string<32> key_type;
+    const key_type key = cppstringx::copy<key_type>(std::string("  Content_Length "));
+    CHECK(cppstringx::equals(key, "  Content_Length "));
+    CHECK(cppstringx::starts_with(key, "  Content"));
+    CHECK(cppstringx::contains(key, "_"));
+    CHECK(cppstringx::equals(cppstringx::trim_copy(key), "Content_Length"));
+    CHECK(cppstringx::equals(cppstringx::to_lower_copy(key, cppstringx::utility::ascii_case()), "  content_length "));
+    CHECK(cppstringx::equals(cppstringx::to_upper_copy(key), "  CONTENT_LENGTH "));
+    CHECK(cppstringx::equals(cppstringx::replace_all_copy(key, "_", "-"), "  Content-Length "));
+    CHECK_THROWS_AS(cppstringx::replace_all_copy(key, "_", std::string(20, '-')), std::length_error);
+    CHECK_THROWS_AS(cppstringx::copy<cppstringx::fixed_string<4>>("Hello"), std::length_error);
+
+    key_type in_place = key;
+    cppstringx::trim_in_place(in_place);
+    cppstringx::replace_all_in_place(in_place, "_", "--");
+    cppstringx::to_lower_in_place(in_place);
+    CHECK(cppstringx::equals(in_place, "content--length"));
+
+    key_type joined;
+    cppstringx::join(joined, std::vector<std::string>({ "a", "b", "c" }), ", ");
+    CHECK(cppstringx::equals(joined, "a, b, c"));
+    CHECK_THROWS_AS(cppstringx::join(joined, std::vector<std::string>(20, "ab"), ","), std::length_error);
+    CHECK(joined.empty()); // The size is checked before anything is appended.
+
+    cppstringx::fixed_string<16, char16_t> wide(u"Straße");
+    CHECK(cppstringx::equals(cppstringx::to_upper_copy(wide, cppstringx::utility::latin1_case()), u"STRAßE"));
+    std::vector<std::string> sections;
+    cppstringx::fixed_string<16> sections_text("a;b");
+    cppstringx::split_token(sections, sections_text, ";");
+    CHECK(sections == std::vector<std::string>({ "a", "b" }));
+}
+
+TEST_CASE("test copies into a caller buffer", "[fixed_string]")
+{
+    char buffer[16];
+    CHECK(cppstringx::copy(buffer, sizeof(buffer), "Hello World") == 11);
+    CHECK(std::string(buffer, 11) == "Hello World");
+    CHECK(cppstringx::copy(buffer, 5, std::string("Hello")) == 5);
+    CHECK_THROWS_AS(cppstringx::copy(buffer, 4, "Hello"), std::length_error);
+    CHECK_THROWS_AS(cppstringx::copy(buffer, 4, std::list<char>(5, 'a')), std::length_error);
+
+    CHECK(cppstringx::replace_all_copy(buffer, sizeof(buffer), "a-b-c", "-", "+") == 5);
+    CHECK(std::string(buffer, 5) == "a+b+c");
+    CHECK(cppstringx::replace_all_copy(buffer, sizeof(buffer), std::string("A-b"), "a", "xx", cppstringx::utility::equals_comparer_ignoring_case()) == 4);
+    CHECK(std::string(buffer, 4) == "xx-b");
+    CHECK_THROWS_AS(cppstringx::replace_all_copy(buffer, sizeof(buffer), "a-b-c", "-", "1234567"), std::length_error);
+    CHECK_THROWS_AS(cppstringx::replace_all_copy(buffer, sizeof(buffer), "abc", "", "x"), std::invalid_argument);
+
+    CHECK(cppstringx::to_lower_copy(buffer, sizeof(buffer), "Hello World") == 11);
+    CHECK(std::string(buffer, 11) == "hello world");
+    CHECK(cppstringx::to_upper_copy(buffer, sizeof(buffer), std::string("Hello World"), cppstringx::utility::ascii_case()) == 11);
+    CHECK(std::string(buffer, 11) == "HELLO WORLD");
+    CHECK(cppstringx::to_upper_copy(buffer, sizeof(buffer), std::list<char>({ 'a', 'b' }), cppstringx::utility::ascii_case()) == 2);
+    CHECK(std::string(buffer, 2) == "AB");
+    CHECK(cppstringx::to_lower_copy(buffer, sizeof(buffer), std::string("\xE2\x84\xAA" "elvin"), cppstringx::utility::unicode_case()) == 6);
+    CHECK(std::string(buffer, 6) == "kelvin");
+    CHECK_THROWS_AS(cppstringx::to_lower_copy(buffer, 4, "Hello"), std::length_error);
+    char16_t wide_buffer[8];
+    CHECK(cppstringx::to_upper_copy(wide_buffer, 8, u"abc", cppstringx::utility::unicode_case()) == 3);
+    CHECK(std::u16string(wide_buffer, 3) == u"ABC");
+
+    CHECK(cppstringx::trim_copy(buffer, sizeof(buffer), "  Hello \t") == 5);
+    CHECK(std::string(buffer, 5) == "Hello");
+    CHECK(cppstringx::trim_copy(buffer, sizeof(buffer), std::string("--a-b--"), cppstringx::utility::char_class("-")) == 3);
+    CHECK(std::string(buffer, 3) == "a-b");
+    CHECK(cppstringx::trim_copy(buffer, 0, "   ") == 0);
+    CHECK_THROWS_AS(cppstringx::trim_copy(buffer, 2, " abc "), std::length_error);
+
+    const std::vector<std::string> items = { "Hello", "World" };
+    CHECK(cppstringx::join(buffer, sizeof(buffer), items, ", ") == 12);
+    CHECK(std::string(buffer, 12) == "Hello, World");
+    CHECK_THROWS_AS(cppstringx::join(buffer, 8, items, ", "), std::length_error);
+}
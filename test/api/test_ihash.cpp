@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    typedef cppstringx::utility::ascii_equals_comparer_ignoring_case ascii_comparer;
+}
+
+TEST_CASE("test ihash and iequal_to", "[ihash]")
+{
+    const cppstringx::utility::ihash<ascii_comparer> hash;
+    const cppstringx::utility::iequal_to<ascii_comparer> equal_to;
+    const std::string header("Content-Length");
+    CHECK(hash(header) == hash("content-length"));
+    CHECK(hash(header) == hash(std::string("CONTENT-LENGTH")));
+    CHECK(hash(header) != hash("Content-Type"));
+    CHECK(hash(header) != hash("Content-Length "));
+    CHECK(equal_to(header, "CONTENT-length"));
+    CHECK_FALSE(equal_to(header, "Content-Lengths"));
+
+    // All text types hash equal strings to the same value, the contiguous and the code unit wise implementation agree.
+    const std::string text = "The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789 [@`{]";
+    std::string lower = text;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return static_cast<char>(c >= 'A' && c <= 'Z' ? c + 32 : c); });
+    for (size_t size = 0; size <= text.size(); ++size)
+    {
+        const std::string prefix = text.substr(0, size);
+        const std::string lower_prefix = lower.substr(0, size);
+        const size_t expected = hash(prefix);
+        CHECK(hash(lower_prefix) == expected);
+        CHECK(hash(lower_prefix.c_str()) == expected);
+        CHECK(hash(cppstringx::range<const char*>(lower_prefix.data(), lower_prefix.data() + size)) == expected);
+        CHECK(hash(std::list<char>(lower_prefix.begin(), lower_prefix.end())) == expected);
+        CHECK(hash(std::vector<unsigned char>(lower_prefix.begin(), lower_prefix.end())) == expected);
+    }
+    // The characters around the ASCII letters are not folded.
+    CHECK(hash("@[`{") != hash("`{@["));
+    CHECK(hash(std::string("\xC1")) != hash(std::string("\xE1")));
+    CHECK(hash(std::string(40, '\0')) != hash(std::string(41, '\0')));
+
+    // Wide strings
+    CHECK(hash(std::u16string(u"Straße")) == hash(u"STRAßE"));
+    CHECK(hash(std::wstring(L"Path")) == hash(L"pATH"));
+}
+
+TEST_CASE("test ihash with other comparers", "[ihash]")
+{
+    const cppstringx::utility::ihash<> locale_hash;
+    CHECK(locale_hash("SELECT") == locale_hash(std::string("select")));
+    CHECK(cppstringx::utility::iequal_to<>()("SELECT", std::string("select")));
+
+    const cppstringx::utility::ihash<cppstringx::utility::latin1_equals_comparer_ignoring_case> latin1_hash;
+    CHECK(latin1_hash(std::string("\xC4pfel")) == latin1_hash(std::string("\xE4PFEL")));
+
+    // The code points are hashed for the Unicode comparer, e.g. the Kelvin sign and k.
+    const cppstringx::utility::ihash<cppstringx::utility::unicode_equals_comparer_ignoring_case> unicode_hash;
+    const cppstringx::utility::iequal_to<cppstringx::utility::unicode_equals_comparer_ignoring_case> unicode_equal_to;
+    CHECK(unicode_equal_to(std::string("\xE2\x84\xAA" "elvin"), "KELVIN"));
+    CHECK(unicode_hash(std::string("\xE2\x84\xAA" "elvin")) == unicode_hash("KELVIN"));
+    CHECK(unicode_hash(u"ΣΣ") == unicode_hash(std::u16string(u"σσ")));
+    CHECK(unicode_hash(std::string("stra\xC3\x9F" "e")) != unicode_hash("strasse"));
+}
+
+TEST_CASE("test ihash and iless in containers", "[ihash]")
+{
+    std::unordered_map<std::string, int, cppstringx::utility::ihash<ascii_comparer>, cppstringx::utility::iequal_to<ascii_comparer>> headers;
+    headers["Content-Length"] = 42;
+    headers["content-type"] = 1;
+    headers["CONTENT-LENGTH"] = 43;
+    CHECK(headers.size() == 2);
+    CHECK(headers.at("content-length") == 43);
+    CHECK(headers.count("Content-Type") == 1);
+
+    std::map<std::string, int, cppstringx::utility::iless<ascii_comparer>> columns;
+    columns["UserId"] = 1;
+    columns["name"] = 2;
+    columns["USERID"] = 3;
+    CHECK(columns.size() == 2);
+    CHECK(columns.begin()->first == "name");
+    CHECK(columns["userid"] == 3);
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+    // The transparent comparison looks up null-terminated strings without creating a std::string.
+    CHECK(columns.find("Name") != columns.end());
+#endif
+
+    std::set<std::u16string, cppstringx::utility::iless<ascii_comparer>> words = { u"beta", u"Alpha", u"ALPHA", u"gamma" };
+    CHECK(words.size() == 3);
+    CHECK(*words.begin() == u"Alpha");
+}
+
+TEST_CASE("test iless ordering", "[ihash]")
+{
+    const cppstringx::utility::iless<ascii_comparer> less;
+    CHECK(less("apple", "Banana"));
+    CHECK_FALSE(less("Banana", "apple"));
+    CHECK(less("abc", "ABCD"));
+    CHECK_FALSE(less("ABCD", "abc"));
+    CHECK_FALSE(less("ABC", "abc"));
+    CHECK_FALSE(less("", ""));
+    CHECK(less("", "a"));
+    // The folded code units are compared as unsigned values.
+    CHECK(less(std::string("z"), std::string("\xE9")));
+    CHECK(less(std::string("_"), std::string("a")));
+    CHECK_FALSE(less(std::string("a"), std::string("[")));
+
+    // The contiguous and the code unit wise implementation agree with comparing lower case copies.
+    std::mt19937 random(25);
+    const char alphabet[] = { 'a', 'A', 'b', 'B', '[', '_', '\xE9' };
+    std::uniform_int_distribution<size_t> letter(0, sizeof(alphabet) - 1);
+    std::uniform_int_distribution<size_t> length(0, 20);
+    const cppstringx::utility::ihash<ascii_comparer> hash;
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string lhs(length(random), 'a');
+        std::string rhs(length(random) / 2, 'a');
+        for (char& value : lhs)
+        {
+            value = alphabet[letter(random)];
+        }
+        for (char& value : rhs)
+        {
+            value = alphabet[letter(random)];
+        }
+        if (i % 2)
+        {
+            rhs = lhs.substr(0, rhs.size()) + rhs;
+        }
+        const std::string lower_lhs = cppstringx::to_lower_copy(lhs, cppstringx::utility::ascii_case());
+        const std::string lower_rhs = cppstringx::to_lower_copy(rhs, cppstringx::utility::ascii_case());
+        const bool expected = std::lexicographical_compare(lower_lhs.begin(), lower_lhs.end(), lower_rhs.begin(), lower_rhs.end(),
+            [](char l, char r) { return static_cast<unsigned char>(l) < static_cast<unsigned char>(r); });
+        CHECK(less(lhs, rhs) == expected);
+        CHECK(less(std::list<char>(lhs.begin(), lhs.end()), rhs.c_str()) == expected);
+        CHECK((hash(lhs) == hash(rhs)) == (lower_lhs == lower_rhs));
+    }
+}
@@ -5,6 +5,7 @@
 #include <catch2/catch.hpp>
 #include <cppstringx/cppstringx.hpp>
 #include <vector>
+#include <list>
 
 TEST_CASE("test join", "[join]")
 {
@@ -14,3 +15,57 @@ TEST_CASE("test join", "[join]")
     CHECK(cppstringx::join(text, v, " - ") == "Hello - World - hello - world");
     CHECK(&cppstringx::join(text, v, " - ") == &text);
 }
+
+TEST_CASE("test join item types", "[join]")
+{
+    // null-terminated strings, mixed code units and an empty separator
+    const char* pointers[] = { "a", "bc", "", "d" };
+    std::string text;
+    CHECK(cppstringx::join(text, pointers, ", ") == "a, bc, , d");
+    CHECK(cppstringx::join(text, pointers, "") == "abcd");
+    std::wstring wide_text;
+    CHECK(cppstringx::join(wide_text, std::vector<std::string>{ "Hello", "World" }, L" ") == L"Hello World");
+    CHECK(cppstringx::join(text, std::vector<std::string>(), "-") == "");
+    CHECK(cppstringx::join(text, std::vector<std::string>{ "single" }, "-") == "single");
+
+    // the memory is allocated once
+    std::vector<std::string> fields(1000, "field");
+    std::string joined;
+    cppstringx::join(joined, fields, ";");
+    CHECK(joined.size() == 1000 * 5 + 999);
+    CHECK(joined.capacity() < 2 * joined.size());
+
+    // ranges filled by the split functions
+    const std::string csv("alpha;beta;;gamma");
+    cppstringx::split_buffer<const std::string> buffer;
+    cppstringx::split_chars_view(buffer, csv, ";");
+    CHECK(cppstringx::join(text, buffer, "|") == "alpha|beta||gamma");
+    std::vector<cppstringx::range<std::string::const_iterator>> ranges;
+    cppstringx::split_chars_view(ranges, csv, ";", cppstringx::split_mode::skip_empty);
+    CHECK(cppstringx::join(text, ranges, " ") == "alpha beta gamma");
+
+    // containers of strings that are read one character at a time
+    std::vector<std::list<char>> lists = { { 'a', 'b' }, { 'c' } };
+    CHECK(cppstringx::join(text, lists, std::list<char>{ '-', '-' }) == "ab--c");
+}
+
+TEST_CASE("test join_to", "[join]")
+{
+    std::vector<std::string> v = { "Hello", "World", "hello", "world" };
+    std::vector<char> buffer;
+    cppstringx::join_to(std::back_inserter(buffer), v, " ");
+    CHECK(std::string(buffer.begin(), buffer.end()) == "Hello World hello world");
+
+    char array[32] = {};
+    char* p_end = cppstringx::join_to(array, v, "-");
+    CHECK(p_end == array + 23);
+    CHECK(std::string(array) == "Hello-World-hello-world");
+
+    std::wstring wide_text;
+    cppstringx::join_to(std::back_inserter(wide_text), std::vector<const char*>{ "a", "b" }, std::string("+"));
+    CHECK(wide_text == L"a+b");
+
+    std::string empty;
+    cppstringx::join_to(std::back_inserter(empty), std::vector<std::string>(), " ");
+    CHECK(empty.empty());
+}
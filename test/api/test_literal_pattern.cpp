@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <list>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+// Literal patterns are computed and compared by the compiler.
+static constexpr auto compile_time_text = cppstringx::make_literal_pattern("/api/v2/users");
+static_assert(compile_time_text.size() == 13, "literal_pattern size");
+static_assert(cppstringx::starts_with(compile_time_text, cppstringx::make_literal_pattern("/api/v2/")), "literal_pattern starts_with");
+static_assert(!cppstringx::starts_with(compile_time_text, cppstringx::make_literal_pattern("/api/v3/")), "literal_pattern starts_with");
+static_assert(cppstringx::ends_with(compile_time_text, cppstringx::make_literal_pattern("users")), "literal_pattern ends_with");
+static_assert(cppstringx::equals(compile_time_text, cppstringx::make_literal_pattern("/api/v2/users")), "literal_pattern equals");
+static_assert(cppstringx::contains(compile_time_text, cppstringx::make_literal_pattern("v2")), "literal_pattern contains");
+static_assert(cppstringx::make_literal_pattern("v2").find_in("/api/v2/", 8) == 5, "literal_pattern find_in");
+#endif
+
+TEST_CASE("test literal_pattern", "[literal_pattern]")
+{
+    static CPPSTRINGX_CONSTEXPR14 auto prefix = cppstringx::make_literal_pattern("/api/v2/");
+    CHECK(prefix.size() == 8);
+    CHECK_FALSE(prefix.empty());
+    CHECK(prefix[1] == 'a');
+    CHECK(cppstringx::string_length(prefix.data()) == 8);
+    CHECK(cppstringx::starts_with(std::string("/api/v2/users"), prefix));
+    CHECK_FALSE(cppstringx::starts_with("/api/v1/users", prefix));
+    CHECK(cppstringx::ends_with(std::string("/legacy/api/v2/"), prefix));
+    CHECK(cppstringx::equals(prefix, "/api/v2/"));
+    CHECK(cppstringx::iequals(prefix, "/API/V2/"));
+    CHECK(cppstringx::equals(cppstringx::make_literal_pattern(""), std::string()));
+
+    const auto empty = cppstringx::make_literal_pattern("");
+    CHECK(empty.empty());
+    CHECK(cppstringx::contains("abc", empty));
+    CHECK(cppstringx::contains(prefix, cppstringx::make_literal_pattern("i/v")));
+    CHECK_FALSE(cppstringx::contains(prefix, cppstringx::make_literal_pattern("v3")));
+    CHECK(cppstringx::starts_with(prefix, empty));
+    CHECK_FALSE(cppstringx::ends_with(empty, prefix));
+
+    const char buffer[16] = "abc";
+    CHECK(cppstringx::make_literal_pattern(buffer).size() == 3);
+
+    // A pattern of 256 code units does not fit the byte-sized shifts.
+    char full_buffer[256];
+    std::fill(full_buffer, full_buffer + 256, 'a');
+    const auto full_pattern = cppstringx::make_literal_pattern(full_buffer);
+    CHECK(full_pattern.size() == 256);
+    CHECK(cppstringx::contains(std::string(300, 'a'), full_pattern));
+    CHECK_FALSE(cppstringx::contains(std::string(255, 'a') + "b" + std::string(255, 'a'), full_pattern));
+    full_buffer[0] = 'b';
+    CHECK(cppstringx::contains(std::string(50, 'a') + "b" + std::string(255, 'a'), cppstringx::make_literal_pattern(full_buffer)));
+}
+
+TEST_CASE("test literal_pattern search", "[literal_pattern]")
+{
+    const auto pattern = cppstringx::make_literal_pattern("abcab");
+    CHECK(cppstringx::contains(std::string("xxabcabxx"), pattern));
+    CHECK(cppstringx::contains("xxabcabxx", pattern));
+    CHECK_FALSE(cppstringx::contains(std::string("xxabcaxbxx"), pattern));
+    CHECK_FALSE(cppstringx::contains("abca", pattern));
+    CHECK(cppstringx::contains(std::list<char>({ 'a', 'a', 'b', 'c', 'a', 'b' }), pattern));
+    CHECK(cppstringx::replace_all_copy(std::string("abcabcabcab"), pattern, "-") == "-c-");
+    std::vector<std::string> sections;
+    cppstringx::split_token(sections, "1, 2, 3", cppstringx::make_literal_pattern(", "));
+    CHECK(sections == std::vector<std::string>({ "1", "2", "3" }));
+
+    // Other comparers than utility::equals_comparer are used instead of the skip table.
+    CHECK(cppstringx::icontains(std::string("/API/v2"), cppstringx::make_literal_pattern("api")));
+    CHECK_FALSE(cppstringx::contains(std::string("/API/v2"), cppstringx::make_literal_pattern("api")));
+    CHECK(cppstringx::ireplace_all_copy(std::string("/API/v2/api"), cppstringx::make_literal_pattern("api"), "x") == "/x/v2/x");
+    CHECK(cppstringx::contains(std::string("/API/v2"), cppstringx::make_literal_pattern("api"), cppstringx::utility::ascii_equals_comparer_ignoring_case()));
+
+    // Wide patterns share skip table entries for characters with the same low byte.
+    const auto wide_pattern = cppstringx::make_literal_pattern(u"šaa");
+    CHECK(cppstringx::contains(std::u16string(u"xxšaayy"), wide_pattern));
+    CHECK_FALSE(cppstringx::contains(std::u16string(u"xxšašyy"), wide_pattern));
+
+    // The skip table is compared with the character-wise search.
+    const std::string text = "aabbaabababbbaabbabababbaabbaaabbbaabb";
+    const char* const patterns[] = { "a", "ab", "ba", "abab", "bbaa", "aabbaab", "bbb", "abba" };
+    for (const char* p_pattern : patterns)
+    {
+        const cppstringx::searcher<char> expected(p_pattern);
+        std::string pattern_buffer(p_pattern);
+        char literal[8] = {};
+        std::copy(pattern_buffer.begin(), pattern_buffer.end(), literal);
+        const auto literal_pattern = cppstringx::make_literal_pattern(literal);
+        for (size_t start = 0; start < text.size(); ++start)
+        {
+            const std::string tail = text.substr(start);
+            CHECK(cppstringx::replace_all_copy(tail, literal_pattern, "#") == cppstringx::replace_all_copy(tail, expected, "#"));
+            CHECK(literal_pattern.find_in(tail.data(), tail.size()) == std::min(tail.find(p_pattern), tail.size()));
+        }
+    }
+}
+
+TEST_CASE("test literal_pattern null-terminated text", "[literal_pattern]")
+{
+    // Null-terminated texts are searched in windows, matches crossing the window ends must be found.
+    const auto pattern = cppstringx::make_literal_pattern("abcab");
+    for (size_t position = 240; position < 1100; position += 7)
+    {
+        std::string text(1200, 'x');
+        text.replace(position, 5, "abcab");
+        const char* p_text = text.c_str();
+        CHECK(cppstringx::contains(p_text, pattern));
+        std::vector<std::string> sections;
+        cppstringx::split_token(sections, p_text, pattern);
+        CHECK(sections == std::vector<std::string>({ text.substr(0, position), text.substr(position + 5) }));
+    }
+    CHECK_FALSE(cppstringx::contains(std::string(1000, 'a').c_str(), pattern));
+}
@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/mapped_text.hpp>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+
+#if defined(CPPSTRINGX_MAPPED_TEXT_WINDOWS) || defined(CPPSTRINGX_MAPPED_TEXT_POSIX)
+namespace
+{
+    void write_file(const char* file_name, const std::string& content)
+    {
+        std::ofstream file(file_name, std::ios::binary);
+        file << content;
+    }
+}
+
+TEST_CASE("mapped_text", "[mapped_text]")
+{
+    const char* file_name = "test_mapped_text.txt";
+    write_file(file_name, "  first line\nsecond line\n\nERROR third line  ");
+    {
+        cppstringx::utility::mapped_text file(file_name, cppstringx::utility::access_hint::sequential);
+        CHECK(!file.empty());
+        CHECK(file.size() == 44);
+        auto text = file.text();
+        CHECK(text.begin() == file.data());
+        CHECK(cppstringx::contains(text, "ERROR"));
+        CHECK(cppstringx::copy<std::string>(cppstringx::trim_copy(text)) == "first line\nsecond line\n\nERROR third line");
+
+        std::vector<std::string> lines;
+        for (auto split_it = cppstringx::make_split_token_iterator(text, "\n"); !split_it.is_end_position(); ++split_it)
+        {
+            lines.push_back(cppstringx::copy<std::string>(*split_it));
+        }
+        CHECK(lines == std::vector<std::string>{ "  first line", "second line", "", "ERROR third line  " });
+
+        std::vector<std::string> words;
+        for (auto split_it = cppstringx::make_split_chars_iterator(text, " \n", cppstringx::split_mode::skip_empty); !split_it.is_end_position(); ++split_it)
+        {
+            words.push_back(cppstringx::copy<std::string>(*split_it));
+        }
+        CHECK(words == std::vector<std::string>{ "first", "line", "second", "line", "ERROR", "third", "line" });
+
+        // moving keeps the ranges valid
+        cppstringx::utility::mapped_text moved(std::move(file));
+        CHECK(file.empty());
+        CHECK(file.text().begin() == file.text().end());
+        CHECK(moved.text().begin() == text.begin());
+        moved = cppstringx::utility::mapped_text(std::string(file_name), cppstringx::utility::access_hint::random);
+        CHECK(cppstringx::equals(moved.text(), "  first line\nsecond line\n\nERROR third line  "));
+    }
+
+    // empty file
+    write_file(file_name, "");
+    {
+        cppstringx::utility::mapped_text file(file_name);
+        CHECK(file.empty());
+        CHECK(file.data() == nullptr);
+        auto text = file.text();
+        CHECK(text.begin() == text.end());
+        CHECK(cppstringx::equals(text, ""));
+    }
+    std::remove(file_name);
+
+    // missing file
+    CHECK_THROWS_AS(cppstringx::utility::mapped_text("test_mapped_text_missing.txt"), std::system_error);
+#if defined(CPPSTRINGX_MAPPED_TEXT_WINDOWS)
+    // wide file names
+    const wchar_t* wide_file_name = L"test_mapped_text_\u00E4\u03A9.txt";
+    {
+        std::ofstream file(wide_file_name, std::ios::binary);
+        file << "wide";
+    }
+    {
+        cppstringx::utility::mapped_text file(std::wstring(wide_file_name));
+        CHECK(cppstringx::equals(file.text(), "wide"));
+    }
+    ::_wremove(wide_file_name);
+    CHECK_THROWS_AS(cppstringx::utility::mapped_text(L"test_mapped_text_missing.txt"), std::system_error);
+#endif
+}
+#endif
@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <list>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    // Creates a string of another code unit type with the same code unit values.
+    template <typename char_type>
+    std::basic_string<char_type> widen(const std::string& text)
+    {
+        std::basic_string<char_type> result;
+        for (char value : text)
+        {
+            result.push_back(static_cast<char_type>(static_cast<unsigned char>(value)));
+        }
+        return result;
+    }
+
+    template <typename char_type>
+    void check_mixed_width_compare()
+    {
+        // The texts are longer than a few vector blocks, a difference is placed at every position.
+        const std::string narrow = "C:\\Program Files\\cppstringx\\include\\cppstringx\\cppstringx.hpp";
+        const std::basic_string<char_type> wide = widen<char_type>(narrow);
+        CHECK(cppstringx::equals(wide, narrow));
+        CHECK(cppstringx::equals(narrow, wide));
+        CHECK(cppstringx::equals(wide, narrow.c_str()));
+        CHECK(cppstringx::equals(narrow.c_str(), wide.c_str()));
+        CHECK(cppstringx::starts_with(wide, "C:\\Program Files\\"));
+        CHECK(cppstringx::starts_with(narrow, wide.substr(0, 40)));
+        CHECK(cppstringx::ends_with(wide, "\\include\\cppstringx\\cppstringx.hpp"));
+        CHECK(cppstringx::ends_with(narrow, wide.substr(3)));
+        CHECK_FALSE(cppstringx::equals(wide, narrow.substr(1)));
+        CHECK_FALSE(cppstringx::equals(wide.substr(1), narrow.c_str()));
+        CHECK_FALSE(cppstringx::starts_with(wide.substr(0, 5), narrow));
+        for (size_t position = 0; position < narrow.size(); ++position)
+        {
+            std::basic_string<char_type> changed = wide;
+            changed[position] = static_cast<char_type>('#');
+            CHECK_FALSE(cppstringx::equals(changed, narrow));
+            CHECK_FALSE(cppstringx::equals(narrow.c_str(), changed));
+            CHECK_FALSE(cppstringx::starts_with(changed, narrow));
+            CHECK_FALSE(cppstringx::ends_with(changed, narrow));
+            CHECK(cppstringx::starts_with(changed, narrow.substr(0, position)));
+            CHECK(cppstringx::ends_with(changed, narrow.substr(position + 1)));
+        }
+    }
+}
+
+TEST_CASE("test mixed width equals, starts_with and ends_with", "[mixed_width]")
+{
+    check_mixed_width_compare<char16_t>();
+    check_mixed_width_compare<char32_t>();
+    check_mixed_width_compare<wchar_t>();
+
+    CHECK(cppstringx::equals(std::u16string(), ""));
+    CHECK(cppstringx::equals("", std::u32string()));
+    CHECK(cppstringx::starts_with(std::wstring(L"abc"), ""));
+    CHECK_FALSE(cppstringx::ends_with(std::string(""), U"c"));
+
+    // Code unit values outside the ASCII range are compared like utility::equals_comparer does, depending on the signedness of char.
+    const std::string latin1(32, static_cast<char>(0xE9));
+    const std::u16string wide_latin1(32, u'\u00E9');
+    const bool is_char_signed = std::is_signed<char>::value;
+    CHECK(cppstringx::equals(latin1, wide_latin1) == !is_char_signed);
+    CHECK(cppstringx::equals(latin1, std::u16string(32, static_cast<char16_t>(0xFFE9))) == false);
+    CHECK(cppstringx::equals(latin1, std::u32string(32, static_cast<char32_t>(0xFFFFFFE9))) == is_char_signed);
+    CHECK(cppstringx::equals(std::vector<unsigned char>(32, 0xE9), wide_latin1));
+    CHECK_FALSE(cppstringx::equals(std::string(32, 'a'), std::u16string(32, static_cast<char16_t>(0x0161))));
+}
+
+TEST_CASE("test mixed width contains and replace", "[mixed_width]")
+{
+    const std::wstring path = L"C:\\Users\\test\\AppData\\Local\\Temp\\cppstringx\\report.txt";
+    CHECK(cppstringx::contains(path, "\\AppData\\"));
+    CHECK(cppstringx::contains(path, std::string("report.txt")));
+    CHECK_FALSE(cppstringx::contains(path, "\\appdata\\"));
+    CHECK(cppstringx::contains(path.c_str(), "Temp"));
+    CHECK(cppstringx::contains(path, ""));
+    CHECK(cppstringx::replace_all_copy(path, "\\", "/") == L"C:/Users/test/AppData/Local/Temp/cppstringx/report.txt");
+    CHECK(cppstringx::replace_all_copy(std::u16string(u"a-b-c"), "-", "+") == u"a+b+c");
+
+    // A narrow text is searched for a wide string, values without an equal char never match.
+    CHECK(cppstringx::contains(std::string("Local\\Temp"), u"Temp"));
+    CHECK_FALSE(cppstringx::contains(std::string("Local\\Temp"), u"Te\u0161p"));
+    CHECK(cppstringx::contains(std::string("a\xE9"), U"\xE9") == !std::is_signed<char>::value);
+
+    // Infixes longer than the conversion buffer are searched code unit by code unit.
+    const std::string long_infix(100, 'x');
+    CHECK(cppstringx::contains(std::u32string(U"ab") + widen<char32_t>(long_infix) + U"cd", long_infix));
+    CHECK_FALSE(cppstringx::contains(std::u32string(U"ab") + widen<char32_t>(long_infix.substr(1)) + U"cd", long_infix));
+}
+
+TEST_CASE("test mixed width agrees with the code unit comparison", "[mixed_width]")
+{
+    // The std::list containers are compared code unit by code unit.
+    std::mt19937 random(24);
+    const char16_t alphabet[] = { u'a', u'b', u'A', u'\u00E9', static_cast<char16_t>(0xFFE9), u'\u0161' };
+    std::uniform_int_distribution<size_t> letter(0, 5);
+    std::uniform_int_distribution<size_t> length(0, 40);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::u16string wide(length(random), u'a');
+        for (char16_t& value : wide)
+        {
+            value = alphabet[letter(random)];
+        }
+        std::string narrow(length(random) / 4, 'a');
+        for (char& value : narrow)
+        {
+            value = static_cast<char>(alphabet[letter(random) % 4]);
+        }
+        const std::list<char16_t> wide_list(wide.begin(), wide.end());
+        const std::list<char> narrow_list(narrow.begin(), narrow.end());
+        CHECK(cppstringx::equals(wide, narrow) == cppstringx::equals(wide_list, narrow_list));
+        CHECK(cppstringx::starts_with(wide, narrow) == cppstringx::starts_with(wide_list, narrow_list));
+        CHECK(cppstringx::ends_with(wide, narrow) == cppstringx::ends_with(wide_list, narrow_list));
+        CHECK(cppstringx::contains(wide, narrow) == cppstringx::contains(wide_list, narrow_list));
+        CHECK(cppstringx::starts_with(narrow, wide.substr(0, 2)) == cppstringx::starts_with(narrow_list, std::list<char16_t>(wide.begin(), wide.begin() + std::min<size_t>(2, wide.size()))));
+    }
+}
@@ -0,0 +1,197 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <list>
+#include <random>
+
+namespace
+{
+    // Finds the leftmost-longest match by comparing every pattern at every position, returns the pattern index or patterns.size().
+    size_t find_first_of_any_reference(const std::string& text, size_t start, const std::vector<std::string>& patterns, size_t& position)
+    {
+        for (position = start; position < text.size(); ++position)
+        {
+            size_t found = patterns.size();
+            for (size_t i = 0; i < patterns.size(); ++i)
+            {
+                if (text.compare(position, patterns[i].size(), patterns[i]) == 0 && (found == patterns.size() || patterns[i].size() > patterns[found].size()))
+                {
+                    found = i;
+                }
+            }
+            if (found != patterns.size())
+            {
+                return found;
+            }
+        }
+        return patterns.size();
+    }
+}
+
+TEST_CASE("multi_searcher", "[multi_searcher]")
+{
+    cppstringx::multi_searcher<char> empty;
+    CHECK(empty.empty());
+    CHECK(empty.size() == 0);
+    CHECK(!cppstringx::contains_any("Hello", empty));
+    CHECK(!cppstringx::contains_any(std::string(), empty));
+    CHECK(!cppstringx::find_first_of_any(std::string("Hello"), empty).is_found());
+
+    const std::vector<std::string> patterns = { "he", "she", "his", "hers" };
+    const cppstringx::multi_searcher<char> searcher(patterns);
+    CHECK(!searcher.empty());
+    CHECK(searcher.size() == 4);
+    CHECK(searcher.get_pattern(2) == "his");
+
+    CHECK_THROWS_AS(cppstringx::multi_searcher<char>({ "a", "" }), std::invalid_argument);
+    CHECK_THROWS_AS(cppstringx::contains_any("abc", { "" }), std::invalid_argument);
+}
+
+TEST_CASE("contains_any", "[multi_searcher]")
+{
+    const cppstringx::multi_searcher<char> forbidden({ "<script", "javascript:", "../" });
+    CHECK(cppstringx::contains_any("/static/../etc/passwd", forbidden));
+    CHECK(cppstringx::contains_any(std::string("<a href=\"javascript:alert(1)\">"), forbidden));
+    CHECK(!cppstringx::contains_any(std::string("<a href=\"/index.html\">"), forbidden));
+    CHECK(!cppstringx::contains_any(std::string("<SCRIPT>"), forbidden));
+    CHECK(cppstringx::contains_any(std::wstring(L"<script>"), forbidden));
+    CHECK(!cppstringx::contains_any(std::u16string(u"<scrip"), forbidden));
+
+    const char* text = "is it ./. or ../.?";
+    CHECK(cppstringx::contains_any(text, forbidden));
+    CHECK(!cppstringx::contains_any(cppstringx::range<const char*>(text, text + 12), forbidden));
+    CHECK(cppstringx::contains_any(cppstringx::range<const char*>(text, text + 16), forbidden));
+    std::list<char> list_text(text, text + 16);
+    CHECK(cppstringx::contains_any(list_text, forbidden));
+
+    CHECK(cppstringx::contains_any("Hello World", { "Universe", "World" }));
+    CHECK(!cppstringx::contains_any("Hello World", { "Universe", "world" }));
+    CHECK(cppstringx::contains_any(L"Hello World", { L"Universe", L"World" }));
+    CHECK(cppstringx::icontains_any("Hello World", { "Universe", "world" }));
+    CHECK(cppstringx::icontains_any(std::string("Hello World"), { "UNIVERSE", "WORLD" }, cppstringx::utility::ascii_equals_comparer_ignoring_case()));
+    CHECK(cppstringx::contains_any(std::string("Hello World"), { "HELLO" }, cppstringx::utility::latin1_equals_comparer_ignoring_case()));
+    CHECK(cppstringx::contains_any(std::string("Hello XllX"), { "?lo?", "X?lX" }, [](char a, char b) { return b == '?' || a == b; }));
+    CHECK(!cppstringx::contains_any(std::string("Hello XllX"), { "?lx?", "X?LX" }, [](char a, char b) { return b == '?' || a == b; }));
+
+    // long texts use the prefilter
+    const cppstringx::multi_searcher<char, cppstringx::utility::ascii_equals_comparer_ignoring_case> iforbidden({ "<script", "javascript:", "../" });
+    std::string long_text(1000, 'x');
+    CHECK(!cppstringx::contains_any(long_text, iforbidden));
+    long_text.replace(700, 7, "<ScRiPt");
+    CHECK(cppstringx::contains_any(long_text, iforbidden));
+    CHECK(!cppstringx::contains_any(long_text, forbidden));
+    CHECK(cppstringx::contains_any(long_text + "../", forbidden));
+}
+
+TEST_CASE("find_first_of_any and find_all_of_any", "[multi_searcher]")
+{
+    const cppstringx::multi_searcher<char> searcher({ "he", "she", "his", "hers" });
+    const std::string text("ushers and his sheep");
+
+    auto first = cppstringx::find_first_of_any(text, searcher);
+    REQUIRE(first.is_found());
+    CHECK(first.pattern_index == 1);
+    CHECK(first.found.begin() - text.begin() == 1);
+    CHECK(cppstringx::copy<std::string>(first.found) == "she");
+
+    std::vector<cppstringx::multi_match<std::string::const_iterator>> matches(3);
+    cppstringx::find_all_of_any(matches, text, searcher);
+    REQUIRE(matches.size() == 3);
+    CHECK(matches[0].pattern_index == 1);
+    CHECK(matches[1].pattern_index == 2);
+    CHECK(cppstringx::copy<std::string>(matches[1].found) == "his");
+    CHECK(matches[2].pattern_index == 1);
+    CHECK(matches[2].found.begin() - text.begin() == 15);
+
+    // the longest pattern starting first is found
+    const cppstringx::multi_searcher<char> nested({ "b", "abcd", "bc" });
+    const char* abcx = "abcx";
+    auto found_abcx = cppstringx::find_first_of_any(abcx, nested);
+    CHECK(found_abcx.pattern_index == 2);
+    CHECK(found_abcx.found.begin() == abcx + 1);
+    CHECK(found_abcx.found.end() == abcx + 3);
+    CHECK(cppstringx::find_first_of_any("abcd", nested).pattern_index == 1);
+
+    std::vector<cppstringx::multi_match<const wchar_t*>> wide_matches;
+    CHECK(cppstringx::find_all_of_any(wide_matches, L"a b bc", nested).size() == 2);
+    CHECK(!cppstringx::find_first_of_any(std::wstring(L"xyz"), nested).is_found());
+
+    // Null-terminated texts are read in windows, the matches crossing the window ends are found.
+    const cppstringx::multi_searcher<char> long_patterns({ "ab", "abcdefgh", "x" });
+    std::string long_text;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        long_text += std::string(i % 11, '-') + (i % 3 == 0 ? "abcdefgh" : "ab");
+    }
+    std::vector<cppstringx::multi_match<std::string::const_iterator>> expected;
+    std::vector<cppstringx::multi_match<const char*>> null_terminated_matches;
+    cppstringx::find_all_of_any(expected, long_text, long_patterns);
+    cppstringx::find_all_of_any(null_terminated_matches, long_text.c_str(), long_patterns);
+    REQUIRE(null_terminated_matches.size() == 300);
+    REQUIRE(expected.size() == 300);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        CHECK(null_terminated_matches[i].pattern_index == expected[i].pattern_index);
+        CHECK(null_terminated_matches[i].found.begin() - long_text.c_str() == expected[i].found.begin() - long_text.begin());
+        CHECK(null_terminated_matches[i].found.end() - long_text.c_str() == expected[i].found.end() - long_text.begin());
+    }
+    CHECK(!cppstringx::find_first_of_any(std::string(1000, '-').c_str(), long_patterns).is_found());
+}
+
+TEST_CASE("multi_searcher compared to a reference", "[multi_searcher]")
+{
+    std::minstd_rand random(7);
+    for (int round = 0; round < 300; ++round)
+    {
+        // few patterns use the prefilter, many patterns starting with different characters do not
+        std::vector<std::string> patterns;
+        const char first_characters = round % 2 == 0 ? 3 : 60;
+        const size_t pattern_count = round % 2 == 0 ? 1 + random() % 6 : 50 + random() % 150;
+        for (size_t i = 0; i < pattern_count; ++i)
+        {
+            std::string pattern(1 + random() % 5, 'a');
+            pattern[0] = static_cast<char>('A' + random() % first_characters);
+            for (size_t j = 1; j < pattern.size(); ++j)
+            {
+                pattern[j] = static_cast<char>('A' + random() % 3);
+            }
+            patterns.push_back(pattern);
+        }
+        std::string text(random() % 200, 'a');
+        for (char& c : text)
+        {
+            c = static_cast<char>('A' + random() % (random() % 4 == 0 ? first_characters : 60));
+        }
+
+        const cppstringx::multi_searcher<char> searcher(patterns);
+        const cppstringx::multi_searcher<char, bool (*)(char, char)> searcher_without_fold(patterns, [](char a, char b) { return a == b; });
+        std::vector<cppstringx::multi_match<std::string::const_iterator>> matches;
+        cppstringx::find_all_of_any(matches, text, searcher);
+        size_t position = 0;
+        size_t match_count = 0;
+        for (size_t start = 0; ; ++match_count)
+        {
+            const size_t found = find_first_of_any_reference(text, start, patterns, position);
+            if (found == patterns.size())
+            {
+                break;
+            }
+            REQUIRE(match_count < matches.size());
+            CHECK(cppstringx::copy<std::string>(matches[match_count].found) == patterns[found]);
+            CHECK(static_cast<size_t>(matches[match_count].found.begin() - text.begin()) == position);
+            start = position + patterns[found].size();
+        }
+        CHECK(matches.size() == match_count);
+
+        const size_t first = find_first_of_any_reference(text, 0, patterns, position);
+        CHECK(cppstringx::contains_any(text, searcher) == (first != patterns.size()));
+        CHECK(cppstringx::contains_any(text.c_str(), searcher) == (first != patterns.size()));
+        CHECK(cppstringx::contains_any(text, searcher_without_fold) == (first != patterns.size()));
+        auto match = cppstringx::find_first_of_any(cppstringx::copy<std::wstring>(text).c_str(), searcher);
+        CHECK(match.is_found() == (first != patterns.size()));
+    }
+}
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+namespace
+{
+    std::string make_random_text(std::minstd_rand& random, size_t max_size, char last_char)
+    {
+        std::string result(random() % max_size, 'a');
+        for (char& c : result)
+        {
+            c = static_cast<char>('a' + random() % static_cast<unsigned>(last_char - 'a' + 1));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("parallel_policy", "[parallel]")
+{
+    CHECK(cppstringx::utility::parallel_policy(4, 10).thread_count(0) == 1);
+    CHECK(cppstringx::utility::parallel_policy(4, 10).thread_count(19) == 1);
+    CHECK(cppstringx::utility::parallel_policy(4, 10).thread_count(25) == 2);
+    CHECK(cppstringx::utility::parallel_policy(4, 10).thread_count(1000) == 4);
+    CHECK(cppstringx::utility::parallel_policy(0, 1).thread_count(1000000) >= 1);
+    CHECK(cppstringx::utility::parallel_policy(4, 0).thread_count(3) == 3);
+}
+
+TEST_CASE("parallel_split_token", "[parallel]")
+{
+    const cppstringx::utility::parallel_policy policy(4, 2);
+    std::string text("a--b----c--");
+    std::vector<std::string> container;
+    cppstringx::parallel_split_token(policy, container, text, "--");
+    CHECK(container == std::vector<std::string>({ "a", "b", "", "c", "" }));
+    cppstringx::parallel_split_token(policy, container, text, "--", cppstringx::split_mode::skip_empty);
+    CHECK(container == std::vector<std::string>({ "a", "b", "c" }));
+    cppstringx::parallel_split_token(policy, container, text, "--", cppstringx::split_mode::skip_empty, false);
+    CHECK(container.size() == 6);
+
+    // self-overlapping separators crossing chunk boundaries
+    std::string overlapping("aaaaabaaa");
+    cppstringx::parallel_split_token(policy, container, overlapping, "aa");
+    CHECK(container == std::vector<std::string>({ "", "", "ab", "a" }));
+
+    // case-insensitive, searcher objects, wide strings and null-terminated strings
+    cppstringx::parallel_split_token(policy, container, "xAndyANDz", "and", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case());
+    CHECK(container == std::vector<std::string>({ "x", "y", "z" }));
+    const cppstringx::searcher<wchar_t> separator(", ");
+    std::wstring wide_text(L"1, 2, 3");
+    std::vector<cppstringx::range<std::wstring::iterator>> ranges;
+    cppstringx::parallel_split_token(policy, ranges, wide_text, separator);
+    REQUIRE(ranges.size() == 3);
+    CHECK(cppstringx::equals(ranges[2], "3"));
+
+    CHECK_THROWS_AS(cppstringx::parallel_split_token(policy, container, text, ""), std::invalid_argument);
+    CHECK(cppstringx::parallel_count_fields_token(policy, text, "--") == 5);
+    CHECK(cppstringx::parallel_count_fields_token(policy, text, "--", cppstringx::split_mode::skip_empty) == 3);
+}
+
+TEST_CASE("parallel_split", "[parallel]")
+{
+    const cppstringx::utility::parallel_policy policy(3, 2);
+    std::string text(",a;;b,c,");
+    std::vector<std::string> container;
+    cppstringx::parallel_split_chars(policy, container, text, ",;");
+    CHECK(container == std::vector<std::string>({ "", "a", "", "b", "c", "" }));
+    cppstringx::parallel_split(policy, container, text, cppstringx::utility::is_any_of<const char*>(",;"), cppstringx::split_mode::skip_empty);
+    CHECK(container == std::vector<std::string>({ "a", "b", "c" }));
+    CHECK(cppstringx::parallel_count_fields(policy, text, cppstringx::utility::char_class(",;")) == 6);
+    CHECK(cppstringx::parallel_count_fields(policy, text, cppstringx::utility::char_class(",;"), cppstringx::split_mode::skip_empty) == 3);
+}
+
+TEST_CASE("parallel_replace_all_copy", "[parallel]")
+{
+    const cppstringx::utility::parallel_policy policy(4, 2);
+    CHECK(cppstringx::parallel_replace_all_copy(policy, std::string("a\r\nb\r\n\r\nc"), "\r\n", "\n") == "a\nb\n\nc");
+    CHECK(cppstringx::parallel_replace_all_copy(policy, std::string("aaaaa"), "aa", "b") == "bba");
+    CHECK(cppstringx::parallel_replace_all_copy(policy, std::string("aaaa"), "aa", "") == "");
+    CHECK(cppstringx::parallel_replace_all_copy(policy, std::wstring(L"Hello World"), "WORLD", "Universe", cppstringx::utility::equals_comparer_ignoring_case()) == L"Hello Universe");
+    CHECK_THROWS_AS(cppstringx::parallel_replace_all_copy(policy, std::string("abc"), "", "x"), std::invalid_argument);
+}
+
+TEST_CASE("parallel functions compared to serial functions", "[parallel]")
+{
+    std::minstd_rand random(13);
+    for (int round = 0; round < 300; ++round)
+    {
+        const std::string text = make_random_text(random, 80, 'c');
+        const std::string separator = make_random_text(random, 3, 'c') + "a";
+        const std::string replacement = make_random_text(random, 4, 'd');
+        const cppstringx::split_mode mode = round % 2 == 0 ? cppstringx::split_mode::all : cppstringx::split_mode::skip_empty;
+        const cppstringx::utility::parallel_policy policy(1 + random() % 8, 1 + random() % 5);
+
+        std::vector<std::string> expected;
+        std::vector<std::string> sections;
+        cppstringx::split_token(expected, text, separator, mode);
+        cppstringx::parallel_split_token(policy, sections, text, separator, mode);
+        CHECK(sections == expected);
+        CHECK(cppstringx::parallel_count_fields_token(policy, text, separator, mode) == expected.size());
+
+        cppstringx::split_chars(expected, text, separator, mode);
+        cppstringx::parallel_split_chars(policy, sections, text, separator, mode);
+        CHECK(sections == expected);
+        CHECK(cppstringx::parallel_count_fields(policy, text, cppstringx::utility::char_class(separator), mode) == expected.size());
+
+        CHECK(cppstringx::parallel_replace_all_copy(policy, text, separator, replacement) == cppstringx::replace_all_copy(text, separator, replacement));
+    }
+}
+
+TEST_CASE("parallel functions compared to serial functions comparing code points", "[parallel]")
+{
+    // The Kelvin sign and the long s are longer than the letters k and s they match, a match may be longer than the pattern.
+    static const char* const parts[] = { "a", "k", "K", "s", "\xE2\x84\xAA", "\xC5\xBF", "\xC3\xA9", "\xC3\x89" };
+    static const char* const patterns[] = { "k", "ks", "sa", "\xC3\xA9k", "KK" };
+    const cppstringx::utility::unicode_equals_comparer_ignoring_case unicode_comparer;
+    std::minstd_rand random(17);
+    for (int round = 0; round < 300; ++round)
+    {
+        std::string text;
+        for (size_t i = random() % 60; i > 0; --i)
+        {
+            text += parts[random() % (sizeof(parts) / sizeof(parts[0]))];
+        }
+        const char* p_pattern = patterns[random() % (sizeof(patterns) / sizeof(patterns[0]))];
+        const cppstringx::split_mode mode = round % 2 == 0 ? cppstringx::split_mode::all : cppstringx::split_mode::skip_empty;
+        const cppstringx::utility::parallel_policy policy(1 + random() % 8, 1 + random() % 5);
+
+        std::vector<std::string> expected;
+        std::vector<std::string> sections;
+        cppstringx::split_token(expected, text, p_pattern, mode, unicode_comparer);
+        cppstringx::parallel_split_token(policy, sections, text, p_pattern, mode, unicode_comparer);
+        CHECK(sections == expected);
+        CHECK(cppstringx::parallel_count_fields_token(policy, text, p_pattern, mode, unicode_comparer) == expected.size());
+        CHECK(cppstringx::parallel_replace_all_copy(policy, text, p_pattern, "-", unicode_comparer) == cppstringx::replace_all_copy(text, p_pattern, "-", unicode_comparer));
+    }
+}
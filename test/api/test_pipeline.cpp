@@ -0,0 +1,140 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <vector>
+#include <random>
+#include <stdexcept>
+#include <cppstringx/cppstringx.hpp>
+
+TEST_CASE("test pipeline copy", "[pipeline]")
+{
+    namespace views = cppstringx::views;
+    //single adaptors
+    {
+        CHECK(views::copy<std::string>(" \t Hello World \n", views::trim()) == "Hello World");
+        CHECK(views::copy<std::string>("  Hello  ", views::trim_start()) == "Hello  ");
+        CHECK(views::copy<std::string>("  Hello  ", views::trim_end()) == "  Hello");
+        CHECK(views::copy<std::string>("--Hello-", views::trim([](char c) { return c == '-'; })) == "Hello");
+        CHECK(views::copy<std::string>("Hello World", views::to_lower(cppstringx::utility::ascii_case())) == "hello world");
+        CHECK(views::copy<std::string>("Hello World", views::to_upper()) == "HELLO WORLD");
+        CHECK(views::copy<std::string>("Hello World", views::replace("o", "0")) == "Hell0 W0rld");
+        CHECK(views::copy<std::string>("aaaa", views::replace("aa", "b")) == "bb");
+        CHECK(views::copy<std::string>("aaabaab", views::replace("aab", "X")) == "aXX");
+        CHECK(views::copy<std::string>("Hello", views::replace("lo!", "X")) == "Hello");
+        CHECK(views::copy<std::string>("HELLO", views::replace("l", "L", cppstringx::utility::equals_comparer_ignoring_case())) == "HELLO");
+        CHECK(views::copy<std::string>("", views::trim()).empty());
+    }
+    //chained adaptors
+    {
+        auto normalize = views::trim() | views::to_lower(cppstringx::utility::ascii_case()) | views::replace("\r\n", "\n");
+        CHECK(views::copy<std::string>("  Line ONE\r\nLine TWO\r\n  ", normalize) == "line one\nline two");
+        CHECK(views::copy<std::string>(std::string(" A\r\nB "), normalize) == "a\nb");
+        CHECK(views::copy<std::wstring>(L" A\r\nB ", views::trim(cppstringx::utility::char_class(L" ")) | views::to_lower(cppstringx::utility::ascii_case()) | views::replace(L"\r\n", L"|")) == L"a|b");
+        std::string target("> ");
+        views::append(target, "  Hello World  ", normalize | views::replace("world", "pipeline"));
+        CHECK(target == "> hello pipeline");
+    }
+    //empty patterns are rejected
+    {
+        CHECK_THROWS_AS(views::replace("", "a"), std::invalid_argument);
+        CHECK_THROWS_AS(views::split(std::string()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("test pipeline split", "[pipeline]")
+{
+    namespace views = cppstringx::views;
+    {
+        std::vector<std::string> fields;
+        views::split_into(fields, "  Red; GREEN ,Blue  ", views::trim() | views::to_lower(cppstringx::utility::ascii_case()) | views::replace(";", ",") | views::split(",") | views::trim());
+        REQUIRE(fields.size() == 3);
+        CHECK(fields[0] == "red");
+        CHECK(fields[1] == "green");
+        CHECK(fields[2] == "blue");
+    }
+    {
+        std::vector<std::string> fields;
+        views::split_into(fields, "a, ,b,,", views::split(",") | views::trim(), cppstringx::split_mode::skip_empty);
+        REQUIRE(fields.size() == 2);
+        CHECK(fields[0] == "a");
+        CHECK(fields[1] == "b");
+        views::split_into(fields, "", views::split(","));
+        CHECK(fields.size() == 1);
+        views::split_into(fields, "c,d", views::split(","), cppstringx::split_mode::all, false /*clear_container*/);
+        CHECK(fields == std::vector<std::string>({ "", "c", "d" }));
+    }
+    {
+        std::vector<std::u16string> fields;
+        views::split_into(fields, std::u16string(u"a - b - c"), views::split(u" - "));
+        REQUIRE(fields.size() == 3);
+        CHECK(fields[2] == u"c");
+    }
+    {
+        size_t count = 0;
+        size_t total_length = 0;
+        views::for_each_section("a; bb;ccc ", views::split(";") | views::trim(), [&count, &total_length](const cppstringx::range<const char*>& section)
+        {
+            ++count;
+            total_length += static_cast<size_t>(section.end() - section.begin());
+        });
+        CHECK(count == 3);
+        CHECK(total_length == 6);
+    }
+}
+
+TEST_CASE("test pipeline compared to separate passes", "[pipeline]")
+{
+    namespace views = cppstringx::views;
+    std::mt19937 random(13);
+    std::uniform_int_distribution<size_t> length(0, 40);
+    std::uniform_int_distribution<size_t> letter(0, 6);
+    const auto is_blank = [](char c) { return c == ' '; };
+    const auto pipeline = views::trim(is_blank) | views::to_lower(cppstringx::utility::ascii_case()) | views::replace("ab", "b") | views::split(";#");
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string text;
+        const size_t text_length = length(random);
+        for (size_t j = 0; j < text_length; ++j)
+        {
+            text += "aAbB;# "[letter(random)];
+        }
+        std::string expected_text = cppstringx::replace_all_copy(cppstringx::to_lower_copy(cppstringx::trim_copy(text, is_blank), cppstringx::utility::ascii_case()), "ab", "b");
+        CHECK(views::copy<std::string>(text, views::trim(is_blank) | views::to_lower(cppstringx::utility::ascii_case()) | views::replace("ab", "b")) == expected_text);
+        std::vector<std::string> expected;
+        cppstringx::split_token(expected, expected_text, ";#");
+        std::vector<std::string> fields;
+        views::split_into(fields, text, pipeline);
+        CHECK(fields == expected);
+    }
+}
+
+TEST_CASE("test pipeline patterns overlapping themselves", "[pipeline]")
+{
+    namespace views = cppstringx::views;
+    std::mt19937 random(29);
+    std::uniform_int_distribution<size_t> length(0, 60);
+    std::uniform_int_distribution<size_t> letter(0, 3);
+    const cppstringx::utility::ascii_equals_comparer_ignoring_case ignoring_case;
+    const char* patterns[] = { "a", "aa", "aab", "abab", "abaab", "AAAB", "aabaaa" };
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string text;
+        const size_t text_length = length(random);
+        for (size_t j = 0; j < text_length; ++j)
+        {
+            text += "aAbB"[letter(random)];
+        }
+        for (const char* pattern : patterns)
+        {
+            CHECK(views::copy<std::string>(text, views::replace(pattern, "#")) == cppstringx::replace_all_copy(text, pattern, "#"));
+            CHECK(views::copy<std::string>(text, views::replace(pattern, "#", ignoring_case)) == cppstringx::replace_all_copy(text, pattern, "#", ignoring_case));
+            std::vector<std::string> expected;
+            cppstringx::split_token(expected, text, pattern);
+            std::vector<std::string> fields;
+            views::split_into(fields, text, views::split(pattern));
+            CHECK(fields == expected);
+        }
+    }
+}
@@ -152,3 +152,66 @@ TEST_CASE("replace_all comparer", "[replace_all]")
         }
     ) == "H---- ----");
 }
+
+namespace
+{
+    // Replaces all occurrences using std::string::find for comparing the results.
+    std::string replace_all_reference(std::string text, const std::string& pattern, const std::string& replacement)
+    {
+        for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + replacement.size()))
+        {
+            text.replace(position, pattern.size(), replacement);
+        }
+        return text;
+    }
+}
+
+TEST_CASE("replace_all shrinking, same size and growing", "[replace_all]")
+{
+    const std::string texts[] = { "", "a", "ab", "aaaa", "abab", "xabyabzab", "ababababababababababababababababababab", "abcabcab" };
+    const std::string patterns[] = { "a", "ab", "aa", "abc", "b" };
+    const std::string replacements[] = { "", "x", "xy", "xyz", "wxyz" };
+    for (const std::string& text : texts)
+    {
+        for (const std::string& pattern : patterns)
+        {
+            for (const std::string& replacement : replacements)
+            {
+                const std::string expected = replace_all_reference(text, pattern, replacement);
+                CHECK(cppstringx::replace_all_copy(text, pattern, replacement) == expected);
+                std::string in_place(text);
+                CHECK(cppstringx::replace_all_in_place(in_place, pattern, replacement) == expected);
+                CHECK(in_place == expected);
+                std::string in_place_pointer(text);
+                CHECK(cppstringx::replace_all_in_place(in_place_pointer, pattern.c_str(), replacement.c_str()) == expected);
+            }
+        }
+    }
+
+    // mixed code unit types
+    CHECK(cppstringx::replace_all_copy(std::wstring(L"Hello World"), "World", "Universe") == L"Hello Universe");
+    CHECK(cppstringx::replace_all_copy(std::u16string(u"a-b-c"), U"-", "") == u"abc");
+    {
+        std::u32string text(U"a--b--c");
+        CHECK(cppstringx::replace_all_in_place(text, U"--", u"+") == U"a+b+c");
+        CHECK(cppstringx::replace_all_in_place(text, U"+", "<=>") == U"a<=>b<=>c");
+    }
+
+    // the text is appended to an existing string object
+    {
+        std::string text("Hello World");
+        std::string result("> ");
+        std::string replacement("Universe");
+        cppstringx::implementation::replace_all_copy_forward(result, cppstringx::implementation::make_const_terminated_iterator_forward(text),
+            cppstringx::implementation::pattern_finder_resolver<const char*, cppstringx::utility::equals_comparer>::make_pattern_finder("World", cppstringx::utility::equals_comparer()),
+            cppstringx::implementation::make_const_terminated_iterator_forward(replacement));
+        CHECK(result == "> Hello Universe");
+    }
+
+    // in-place using a searcher
+    {
+        std::string text(100, 'a');
+        auto searcher = cppstringx::make_searcher(std::string("aaa"));
+        CHECK(cppstringx::replace_all_in_place(text, searcher, "b") == std::string(33, 'b') + "a");
+    }
+}
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <map>
+#include <random>
+
+namespace
+{
+    // Replaces the leftmost-longest matches by comparing every pattern at every position.
+    std::string replace_all_map_reference(const std::string& text, const std::vector<std::pair<std::string, std::string>>& pairs)
+    {
+        std::string result;
+        size_t position = 0;
+        while (position < text.size())
+        {
+            size_t found = pairs.size();
+            for (size_t i = 0; i < pairs.size(); ++i)
+            {
+                const std::string& pattern = pairs[i].first;
+                if (text.compare(position, pattern.size(), pattern) == 0 && (found == pairs.size() || pattern.size() > pairs[found].first.size()))
+                {
+                    found = i;
+                }
+            }
+            if (found == pairs.size())
+            {
+                result.push_back(text[position]);
+                ++position;
+            }
+            else
+            {
+                result += pairs[found].second;
+                position += pairs[found].first.size();
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("replacement_map", "[replace_all_map]")
+{
+    cppstringx::replacement_map<char> empty;
+    CHECK(empty.empty());
+    CHECK(empty.size() == 0);
+    CHECK(!empty.has_growing_replacement());
+    CHECK(cppstringx::replace_all_map_copy(std::string("Hello"), empty) == "Hello");
+
+    const cppstringx::replacement_map<char> html_escape({ { "&", "&amp;" }, { "<", "&lt;" }, { ">", "&gt;" } });
+    CHECK(!html_escape.empty());
+    CHECK(html_escape.size() == 3);
+    CHECK(html_escape.get_pattern(1) == "<");
+    CHECK(html_escape.get_replacement(1) == "&lt;");
+    CHECK(html_escape.has_growing_replacement());
+
+    std::map<std::string, std::string> pairs;
+    pairs["&amp;"] = "&";
+    pairs["&lt;"] = "<";
+    const cppstringx::replacement_map<wchar_t> html_unescape(pairs);
+    CHECK(html_unescape.size() == 2);
+    CHECK(html_unescape.get_pattern(0) == L"&amp;");
+    CHECK(!html_unescape.has_growing_replacement());
+
+    CHECK_THROWS_AS(cppstringx::replacement_map<char>({ { "a", "b" }, { "", "c" } }), std::invalid_argument);
+    CHECK_THROWS_AS(cppstringx::replace_all_map_copy(std::string("abc"), { { "", "c" } }), std::invalid_argument);
+    std::string text("abc");
+    CHECK_THROWS_AS(cppstringx::replace_all_map_in_place(text, { { "", "c" } }), std::invalid_argument);
+    CHECK(text == "abc");
+}
+
+TEST_CASE("replace_all_map", "[replace_all_map]")
+{
+    // escape and unescape
+    const std::string html("<a href=\"x\">Tom & Jerry</a>");
+    const std::string escaped("&lt;a href=&quot;x&quot;&gt;Tom &amp; Jerry&lt;/a&gt;");
+    const cppstringx::replacement_map<char> html_escape({ { "&", "&amp;" }, { "<", "&lt;" }, { ">", "&gt;" }, { "\"", "&quot;" } });
+    const cppstringx::replacement_map<char> html_unescape({ { "&amp;", "&" }, { "&lt;", "<" }, { "&gt;", ">" }, { "&quot;", "\"" } });
+    CHECK(cppstringx::replace_all_map_copy(html, html_escape) == escaped);
+    CHECK(cppstringx::replace_all_map_copy(escaped, html_unescape) == html);
+    {
+        std::string in_place(html);
+        CHECK(cppstringx::replace_all_map_in_place(in_place, html_escape) == escaped);
+        CHECK(in_place == escaped);
+        CHECK(cppstringx::replace_all_map_in_place(in_place, html_unescape) == html);
+        CHECK(in_place == html);
+    }
+
+    // replaced text is not searched again
+    CHECK(cppstringx::replace_all_map_copy(std::string("a&lt;b"), { { "&", "&amp;" }, { "<", "&lt;" } }) == "a&amp;lt;b");
+    CHECK(cppstringx::replace_all_map_copy(std::string("abab"), { { "a", "b" }, { "b", "a" } }) == "baba");
+
+    // the leftmost match is replaced, the longest one if several matches start at the same position
+    CHECK(cppstringx::replace_all_map_copy(std::string("abcd"), { { "bcd", "1" }, { "ab", "2" } }) == "2cd");
+    CHECK(cppstringx::replace_all_map_copy(std::string("abcd"), { { "b", "1" }, { "abcd", "2" } }) == "2");
+    CHECK(cppstringx::replace_all_map_copy(std::string("abcx"), { { "b", "1" }, { "abcd", "2" } }) == "a1cx");
+    CHECK(cppstringx::replace_all_map_copy(std::string("he she hers"), { { "he", "1" }, { "she", "2" }, { "hers", "3" }, { "his", "4" } }) == "1 2 3");
+    CHECK(cppstringx::replace_all_map_copy(std::string("aaaa"), { { "a", "1" }, { "aa", "2" }, { "aaa", "3" } }) == "31");
+
+    // the first pair is used for duplicate patterns
+    CHECK(cppstringx::replace_all_map_copy(std::string("xax"), { { "a", "1" }, { "a", "2" } }) == "x1x");
+
+    // case-insensitive
+    CHECK(cppstringx::ireplace_all_map_copy(std::string("a &LT; b &Amp;&amp; c"), { { "&amp;", "&" }, { "&lt;", "<" } }) == "a < b && c");
+    CHECK(cppstringx::ireplace_all_map_copy(std::string("Hello World"), { { "WORLD", "Universe" } }, cppstringx::utility::ascii_equals_comparer_ignoring_case()) == "Hello Universe");
+    CHECK(cppstringx::replace_all_map_copy(std::string("Hello World"), { { "hello", "Hi" }, { "world", "Universe" } }, cppstringx::utility::equals_comparer_ignoring_case()) == "Hi Universe");
+    {
+        std::string in_place("HELLO world");
+        CHECK(cppstringx::ireplace_all_map_in_place(in_place, { { "hello", "Hi" }, { "WORLD", "Universe" } }) == "Hi Universe");
+        CHECK(cppstringx::ireplace_all_map_in_place(in_place, { { "hi", "" } }, cppstringx::utility::latin1_equals_comparer_ignoring_case()) == " Universe");
+        const cppstringx::replacement_map<char, cppstringx::utility::ascii_equals_comparer_ignoring_case> iunescape({ { "&AMP;", "&" } });
+        CHECK(cppstringx::replace_all_map_in_place(in_place.assign("a&amp;b&Amp;c"), iunescape) == "a&b&c");
+    }
+
+    // comparer without fold
+    CHECK(cppstringx::replace_all_map_copy(std::string("Hello XllX"), { { "?ll?", "----" }, { "H", "h" } }, [](char a, char b) {
+            return b == '?' || a == b;
+        }
+    ) == "h---- ----");
+    {
+        std::string in_place("a&b<c");
+        CHECK(cppstringx::replace_all_map_in_place(in_place, { { "&", "&amp;" }, { "<", "&lt;" } }, [](char a, char b) { return a == b; }) == "a&amp;b&lt;c");
+    }
+
+    // mixed code unit types
+    const cppstringx::replacement_map<char> dashes({ { "--", "+" }, { "-", "" } });
+    CHECK(cppstringx::replace_all_map_copy(std::wstring(L"a---b-c"), dashes) == L"a+bc");
+    CHECK(cppstringx::replace_all_map_copy(std::u16string(u"a---b-c"), dashes) == u"a+bc");
+    {
+        std::u32string text(U"a--b\U0001F600c");
+        const cppstringx::replacement_map<char32_t> emoji({ { U"\U0001F600", U":)" }, { U"--", U"-" } });
+        CHECK(cppstringx::replace_all_map_in_place(text, emoji) == U"a-b:)c");
+        CHECK(cppstringx::replace_all_map_copy(text, dashes) == U"ab:)c");
+    }
+    CHECK(cppstringx::replace_all_map_copy(std::string("a\xE9 b"), cppstringx::replacement_map<wchar_t>(std::vector<std::pair<std::wstring, std::wstring>>{ { L"\u00E9", L"e" } })) == "ae b");
+}
+
+TEST_CASE("replace_all_map compared to a reference", "[replace_all_map]")
+{
+    std::minstd_rand random(42);
+    for (int round = 0; round < 300; ++round)
+    {
+        std::vector<std::pair<std::string, std::string>> pairs;
+        const size_t pair_count = 1 + random() % 6;
+        for (size_t i = 0; i < pair_count; ++i)
+        {
+            std::string pattern(1 + random() % 4, 'a');
+            for (char& c : pattern)
+            {
+                c = static_cast<char>('a' + random() % 3);
+            }
+            std::string replacement(random() % 6, 'x');
+            pairs.push_back(std::make_pair(pattern, replacement));
+        }
+        std::string text(random() % 40, 'a');
+        for (char& c : text)
+        {
+            c = static_cast<char>('a' + random() % 3);
+        }
+
+        // remove duplicate patterns, the reference uses the first pair as well
+        std::vector<std::pair<std::string, std::string>> unique_pairs;
+        for (const auto& pair : pairs)
+        {
+            bool is_duplicate = false;
+            for (const auto& unique_pair : unique_pairs)
+            {
+                is_duplicate = is_duplicate || unique_pair.first == pair.first;
+            }
+            if (!is_duplicate)
+            {
+                unique_pairs.push_back(pair);
+            }
+        }
+
+        const std::string expected = replace_all_map_reference(text, unique_pairs);
+        const cppstringx::replacement_map<char> replacements(pairs);
+        CHECK(cppstringx::replace_all_map_copy(text, replacements) == expected);
+        std::string in_place(text);
+        CHECK(cppstringx::replace_all_map_in_place(in_place, replacements) == expected);
+        const cppstringx::replacement_map<char, bool (*)(char, char)> replacements_without_fold(pairs, [](char a, char b) { return a == b; });
+        CHECK(cppstringx::replace_all_map_copy(text, replacements_without_fold) == expected);
+        std::wstring in_place_wide = cppstringx::copy<std::wstring>(text);
+        CHECK(cppstringx::copy<std::string>(cppstringx::replace_all_map_in_place(in_place_wide, replacements)) == expected);
+    }
+}
@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename split_iterator_type>
+    std::vector<std::string> collect_sections(split_iterator_type split_it)
+    {
+        std::vector<std::string> result;
+        while (!split_it.is_end_position())
+        {
+            result.push_back(cppstringx::copy<std::string>(*split_it));
+            ++split_it;
+        }
+        return result;
+    }
+
+    std::vector<std::string> reversed(std::vector<std::string> sections)
+    {
+        std::reverse(sections.begin(), sections.end());
+        return sections;
+    }
+}
+
+TEST_CASE("reverse_split_token_iterator", "[reverse_split]")
+{
+    std::string text = "Hello World";
+    auto split_it = cppstringx::make_reverse_split_token_iterator(text, " ");
+    REQUIRE(!split_it.is_end_position());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "World");
+    *split_it->begin() = 'V';
+    CHECK(text == "Hello Vorld");
+    split_it++;
+    REQUIRE(!split_it.is_end_position());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "Hello");
+    ++split_it;
+    CHECK(split_it.is_end_position());
+    ++split_it;
+    CHECK(split_it.is_end_position());
+
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("Hello World", "l")) == std::vector<std::string>({ "d", "o Wor", "", "He" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("Hello World", "l", cppstringx::split_mode::skip_empty)) == std::vector<std::string>({ "d", "o Wor", "He" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("xHelloxWorldx", "x")) == std::vector<std::string>({ "", "World", "Hello", "" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("Hello World", "x")) == std::vector<std::string>({ "Hello World" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("", "x")) == std::vector<std::string>({ "" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("", "x", cppstringx::split_mode::skip_empty)).empty());
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("xx", "x", cppstringx::split_mode::skip_empty)).empty());
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("a - b - c", std::string(" - "))) == std::vector<std::string>({ "c", "b", "a" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator(L"a - b - c", L" - ")) == std::vector<std::string>({ "c", "b", "a" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator(u"aXbxc", u"x", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case())) == std::vector<std::string>({ "c", "b", "a" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_token_iterator("aXbxc", "x", cppstringx::split_mode::all, [](char a, char b) { return a == b || a == 'X'; })) == std::vector<std::string>({ "c", "b", "a" }));
+
+    //the nth field from the right
+    {
+        const std::string line = "a;b;c;d;e";
+        auto field_it = cppstringx::make_reverse_split_token_iterator(line, ";");
+        CHECK(field_it.advance(2));
+        CHECK(std::string(field_it->begin(), field_it->end()) == "c");
+        CHECK(!field_it.advance(3));
+    }
+
+    typedef cppstringx::reverse_split_token_iterator<std::string, const char*, cppstringx::utility::equals_comparer> reverse_split_token_iterator_type;
+    CHECK_THROWS_AS(reverse_split_token_iterator_type(text, "", cppstringx::split_mode::all, cppstringx::utility::equals_comparer()), std::invalid_argument);
+}
+
+TEST_CASE("reverse_split_token_iterator matches split_token_iterator", "[reverse_split]")
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> letter(0, 3);
+    std::uniform_int_distribution<size_t> length(0, 200);
+    const char* separators[] = { ",", ";#", "ab", "abc", "0123456789abcdefghijklmnopqrstuvwxyz" };
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string text;
+        const size_t text_length = length(random);
+        for (size_t j = 0; j < text_length; ++j)
+        {
+            text += "a,;b"[letter(random)];
+            if (j % 37 == 0)
+            {
+                text += separators[j % 5];
+            }
+        }
+        for (const char* separator : separators)
+        {
+            for (auto mode : { cppstringx::split_mode::all, cppstringx::split_mode::skip_empty })
+            {
+                CHECK(reversed(collect_sections(cppstringx::make_reverse_split_token_iterator(text, separator, mode))) == collect_sections(cppstringx::make_split_token_iterator(text, separator, mode)));
+                const std::u32string text32 = cppstringx::copy<std::u32string>(text);
+                const std::u32string separator32 = cppstringx::copy<std::u32string>(separator);
+                CHECK(reversed(collect_sections(cppstringx::make_reverse_split_token_iterator(text32, separator32, mode))) == collect_sections(cppstringx::make_split_token_iterator(text32, separator32, mode)));
+                const std::string upper_separator = cppstringx::to_upper_copy(std::string(separator));
+                const cppstringx::utility::ascii_equals_comparer_ignoring_case ignoring_case;
+                CHECK(reversed(collect_sections(cppstringx::make_reverse_split_token_iterator(text, upper_separator, mode, ignoring_case))) == collect_sections(cppstringx::make_split_token_iterator(text, upper_separator, mode, ignoring_case)));
+                std::list<char> list_text(text.begin(), text.end());
+                CHECK(reversed(collect_sections(cppstringx::make_reverse_split_token_iterator(list_text, separator, mode))) == collect_sections(cppstringx::make_split_token_iterator(list_text, separator, mode)));
+            }
+        }
+    }
+}
+
+TEST_CASE("reverse_split_iterator", "[reverse_split]")
+{
+    std::string path = "C:\\data/archive.tar.gz";
+    auto split_it = cppstringx::make_reverse_split_chars_iterator(path, "\\/");
+    REQUIRE(!split_it.is_end_position());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "archive.tar.gz");
+
+    CHECK(collect_sections(cppstringx::make_reverse_split_chars_iterator("a,b;c", ",;")) == std::vector<std::string>({ "c", "b", "a" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_chars_iterator(",a,,b,", ",")) == std::vector<std::string>({ "", "b", "", "a", "" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_chars_iterator(",a,,b,", ",", cppstringx::split_mode::skip_empty)) == std::vector<std::string>({ "b", "a" }));
+    CHECK(collect_sections(cppstringx::make_reverse_split_chars_iterator("", ",")) == std::vector<std::string>({ "" }));
+    const std::string separators_only(",,");
+    CHECK(collect_sections(cppstringx::make_reverse_split_chars_iterator(separators_only, cppstringx::utility::char_class(","), cppstringx::split_mode::skip_empty)).empty());
+    CHECK(collect_sections(cppstringx::make_reverse_split_iterator("a b\tc", cppstringx::utility::is_space())) == std::vector<std::string>({ "c", "b", "a" }));
+
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> letter(0, 5);
+    for (int i = 0; i < 100; ++i)
+    {
+        std::string text(static_cast<size_t>(i * 3), ' ');
+        for (char& c : text)
+        {
+            c = "ab,; x"[letter(random)];
+        }
+        for (auto mode : { cppstringx::split_mode::all, cppstringx::split_mode::skip_empty })
+        {
+            CHECK(reversed(collect_sections(cppstringx::make_reverse_split_chars_iterator(text, cppstringx::utility::char_class(",; "), mode))) ==
+                collect_sections(cppstringx::make_split_chars_iterator(text, cppstringx::utility::char_class(",; "), mode)));
+            const char* p_text = text.c_str();
+            CHECK(reversed(collect_sections(cppstringx::make_reverse_split_chars_iterator(p_text, ",; ", mode))) ==
+                collect_sections(cppstringx::make_split_chars_iterator(p_text, ",; ", mode)));
+        }
+    }
+}
+
+TEST_CASE("advance_to_last skipping empty sections", "[reverse_split]")
+{
+    std::string text = "a,,b,,";
+    auto split_it = cppstringx::make_split_token_iterator(text, ",", cppstringx::split_mode::skip_empty);
+    CHECK(split_it.advance_to_last());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "b");
+    ++split_it;
+    CHECK(split_it.is_end_position());
+    auto chars_it = cppstringx::make_split_chars_iterator(text, ",", cppstringx::split_mode::skip_empty);
+    CHECK(chars_it.advance_to_last());
+    CHECK(std::string(chars_it->begin(), chars_it->end()) == "b");
+    ++chars_it;
+    CHECK(chars_it.is_end_position());
+}
+
+TEST_CASE("last_field and nth_field_from_end", "[reverse_split]")
+{
+    std::string line = "a;b;;c;d";
+    CHECK(cppstringx::copy<std::string>(cppstringx::last_field(line, ";")) == "d");
+    CHECK(cppstringx::copy<std::string>(cppstringx::nth_field_from_end(line, ";", 0)) == "d");
+    CHECK(cppstringx::copy<std::string>(cppstringx::nth_field_from_end(line, ";", 2)) == "");
+    CHECK(cppstringx::copy<std::string>(cppstringx::nth_field_from_end(line, ";", 2, cppstringx::split_mode::skip_empty)) == "b");
+    CHECK(cppstringx::copy<std::string>(cppstringx::nth_field_from_end(line, ";", 4)) == "a");
+    auto missing = cppstringx::nth_field_from_end(line, ";", 5);
+    CHECK(missing.begin() == line.begin());
+    CHECK(missing.end() == line.begin());
+    CHECK(cppstringx::nth_field_from_end(line, ";", 4, cppstringx::split_mode::skip_empty).begin() == line.begin());
+
+    // paths ending with a separator, file name extensions and case-insensitive separators
+    const char* path = "/usr/local/share/doc/";
+    CHECK(cppstringx::equals(cppstringx::last_field(path, "/"), ""));
+    CHECK(cppstringx::equals(cppstringx::last_field(path, "/", cppstringx::split_mode::skip_empty), "doc"));
+    CHECK(cppstringx::equals(cppstringx::nth_field_from_end(path, "/", 2, cppstringx::split_mode::skip_empty), "local"));
+    const std::string file_name = "archive.tar.gz";
+    auto extension = cppstringx::last_field(file_name, ".");
+    CHECK(cppstringx::equals(extension, "gz"));
+    CHECK(extension.end() == file_name.end());
+    std::string text = "oneANDtwoandthree";
+    CHECK(cppstringx::equals(cppstringx::nth_field_from_end(text, "and", 1, cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case()), "two"));
+    CHECK(cppstringx::equals(cppstringx::last_field(text, "AND", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case()), "three"));
+
+    // empty strings
+    std::string empty;
+    CHECK(cppstringx::last_field(empty, ";").begin() == empty.begin());
+    CHECK(cppstringx::last_field(empty, ";", cppstringx::split_mode::skip_empty).begin() == empty.begin());
+    CHECK_THROWS_AS(cppstringx::last_field(line, ""), std::invalid_argument);
+}
@@ -0,0 +1,182 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <random>
+
+TEST_CASE("searcher construction", "[searcher]")
+{
+    cppstringx::searcher<char> empty_searcher;
+    CHECK(empty_searcher.empty());
+    CHECK(empty_searcher.size() == 0);
+
+    cppstringx::searcher<char> searcher1("Hello");
+    CHECK(!searcher1.empty());
+    CHECK(searcher1.size() == 5);
+    CHECK(searcher1.pattern() == "Hello");
+
+    cppstringx::searcher<wchar_t> searcher2(std::string("World"));
+    CHECK(searcher2.pattern() == L"World");
+
+    auto searcher3 = cppstringx::make_searcher(u"abc");
+    CHECK(searcher3.pattern() == u"abc");
+}
+
+TEST_CASE("searcher contains", "[searcher]")
+{
+    auto searcher = cppstringx::make_searcher("World");
+    CHECK(cppstringx::contains("Hello World", searcher)); //at end
+    CHECK(cppstringx::contains("World Hello", searcher)); //at begin
+    CHECK(cppstringx::contains("Hello World Hello", searcher)); //inner
+    CHECK(cppstringx::contains("World", searcher)); //equal size
+    CHECK(!cppstringx::contains("Worl", searcher)); //larger pattern
+    CHECK(!cppstringx::contains("Hello Worle", searcher)); //almost matching
+    CHECK(!cppstringx::contains("", searcher)); //empty text
+    CHECK(cppstringx::contains("", cppstringx::searcher<char>())); //empty pattern
+    CHECK(cppstringx::contains("Hello", cppstringx::searcher<char>())); //empty pattern
+
+    //types
+    char buffer[] = { "Hello World" };
+    std::string text1("Hello World");
+    const std::wstring text2(L"Hello World");
+    cppstringx::range<std::string::iterator> text3(text1.begin(), text1.end());
+    cppstringx::range<const char*> text4(buffer, buffer + 11);
+    CHECK(cppstringx::contains(buffer, searcher));
+    CHECK(cppstringx::contains(text1, searcher));
+    CHECK(cppstringx::contains(text2, searcher));
+    CHECK(cppstringx::contains(text3, searcher));
+    CHECK(cppstringx::contains(text4, searcher));
+    CHECK(!cppstringx::contains(cppstringx::range<const char*>(buffer, buffer + 10), searcher));
+}
+
+TEST_CASE("searcher comparer", "[searcher]")
+{
+    auto isearcher = cppstringx::make_isearcher("WORLD");
+    // make_isearcher uses the shared cache of the global locale like the other i* functions.
+    CHECK(std::is_same<decltype(isearcher), cppstringx::searcher<char, cppstringx::utility::cached_equals_comparer_ignoring_case>>::value);
+    CHECK(cppstringx::contains("Hello World", isearcher));
+    CHECK(cppstringx::contains(L"Hello world", isearcher));
+    CHECK(!cppstringx::contains("Hello Worle", isearcher));
+
+    auto ascii_searcher = cppstringx::make_searcher("content-TYPE", cppstringx::utility::ascii_equals_comparer_ignoring_case());
+    CHECK(cppstringx::contains("Accept: */*\r\nContent-Type: text/html\r\n", ascii_searcher));
+    CHECK(!cppstringx::contains("Accept: */*\r\nContent-Length: 0\r\n", ascii_searcher));
+
+    // A lambda expression is used with the character-wise search.
+    auto digit_searcher = cppstringx::make_searcher("dd.dd", [](char l, char r) { if (r == 'd' && l >= '0' && l <= '9') return true; return r == l; });
+    CHECK(cppstringx::contains(" 11.11.2011 ", digit_searcher));
+    CHECK(!cppstringx::contains(" 11-11-2011 ", digit_searcher));
+}
+
+TEST_CASE("searcher replace_all", "[searcher]")
+{
+    auto searcher = cppstringx::make_searcher("aa");
+    CHECK(cppstringx::replace_all_copy(std::string("aaaa aaaa"), searcher, "123") == "123123 123123");
+    std::string text("aaaaa aaaa");
+    CHECK(cppstringx::replace_all_in_place(text, searcher, "b") == "bba bb");
+
+    auto isearcher = cppstringx::make_isearcher("L");
+    CHECK(cppstringx::replace_all_copy(std::wstring(L"Hello World"), isearcher, "123") == L"He123123o Wor123d");
+
+    CHECK_THROWS_AS(cppstringx::replace_all_copy(std::string("Hello World"), cppstringx::searcher<char>(), "H"), std::invalid_argument);
+    CHECK_THROWS_AS(cppstringx::replace_all_in_place(text, cppstringx::searcher<char>(), "H"), std::invalid_argument);
+}
+
+TEST_CASE("searcher split_token", "[searcher]")
+{
+    auto separator = cppstringx::make_searcher("\r\n\r\n");
+    std::string text = "a\r\n\r\nbb\r\n\r\n\r\n\r\nccc\r\n";
+    {
+        std::vector<std::string> result;
+        std::vector<std::string> expected = { "a", "bb", "", "ccc\r\n" };
+        cppstringx::split_token(result, text, separator);
+        CHECK(result == expected);
+    }
+    {
+        std::vector<std::string> result;
+        std::vector<std::string> expected = { "a", "bb", "ccc\r\n" };
+        cppstringx::split_token(result, text, separator, cppstringx::split_mode::skip_empty);
+        CHECK(result == expected);
+    }
+    {
+        auto split_it = cppstringx::make_split_token_iterator(text, separator);
+        CHECK(split_it.advance_to_last());
+        CHECK(std::string(split_it->begin(), split_it->end()) == "ccc\r\n");
+    }
+    CHECK_THROWS_AS(cppstringx::make_split_token_iterator(text, cppstringx::searcher<char>()), std::invalid_argument);
+}
+
+TEST_CASE("searcher compared to std::string::find", "[searcher]")
+{
+    // Small alphabets produce many partial matches and periodic patterns.
+    std::mt19937 generator(42);
+    for (int alphabet_size = 1; alphabet_size <= 4; ++alphabet_size)
+    {
+        std::uniform_int_distribution<int> char_distribution(0, alphabet_size - 1);
+        std::uniform_int_distribution<int> text_size_distribution(0, 60);
+        std::uniform_int_distribution<int> pattern_size_distribution(1, 8);
+        for (int run = 0; run < 500; ++run)
+        {
+            std::string text;
+            std::string pattern;
+            for (int i = text_size_distribution(generator); i > 0; --i)
+            {
+                text.push_back(static_cast<char>('a' + char_distribution(generator)));
+            }
+            for (int i = pattern_size_distribution(generator); i > 0; --i)
+            {
+                pattern.push_back(static_cast<char>('a' + char_distribution(generator)));
+            }
+            size_t expected = text.find(pattern);
+
+            cppstringx::searcher<char> searcher(pattern);
+            auto found = searcher.find_forward(cppstringx::implementation::make_const_terminated_iterator_forward(text));
+            size_t position = found.begin().is_end_position() ? std::string::npos : static_cast<size_t>(found.begin().get_position() - text.begin());
+            CHECK(position == expected);
+
+            auto found_null_terminated = searcher.find_forward(cppstringx::implementation::make_const_terminated_iterator_forward(text.c_str()));
+            size_t position_null_terminated = found_null_terminated.begin().is_end_position() ? std::string::npos : static_cast<size_t>(found_null_terminated.begin().get_position() - text.c_str());
+            CHECK(position_null_terminated == expected);
+
+            CHECK(cppstringx::replace_all_copy(text, searcher, "-") == cppstringx::replace_all_copy(text, pattern, "-"));
+        }
+    }
+}
+
+TEST_CASE("searcher null-terminated text longer than the search window", "[searcher]")
+{
+    // Null-terminated texts are searched in windows, matches crossing the window ends must be found.
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> char_distribution(0, 1);
+    std::uniform_int_distribution<int> text_size_distribution(0, 3000);
+    std::uniform_int_distribution<int> pattern_size_distribution(1, 100);
+    for (int run = 0; run < 200; ++run)
+    {
+        std::string pattern(static_cast<size_t>(pattern_size_distribution(generator)), 'b');
+        pattern[0] = 'a';
+        std::string text;
+        for (int i = text_size_distribution(generator); i > 0; --i)
+        {
+            text.push_back(static_cast<char>('a' + char_distribution(generator)));
+        }
+        text.insert(static_cast<size_t>(text_size_distribution(generator)) % (text.size() + 1), pattern);
+
+        cppstringx::searcher<char> searcher(pattern);
+        auto found = searcher.find_forward(cppstringx::implementation::make_const_terminated_iterator_forward(text.c_str()));
+        size_t position = found.begin().is_end_position() ? std::string::npos : static_cast<size_t>(found.begin().get_position() - text.c_str());
+        CHECK(position == text.find(pattern));
+        CHECK(static_cast<size_t>(found.end().get_position() - found.begin().get_position()) == pattern.size());
+        std::vector<std::string> sections;
+        std::vector<std::string> expected;
+        const char* p_text = text.c_str();
+        cppstringx::split_token(sections, p_text, searcher);
+        cppstringx::split_token(expected, text, pattern);
+        CHECK(sections == expected);
+    }
+    auto not_found = cppstringx::make_searcher("abc").find_forward(cppstringx::implementation::make_const_terminated_iterator_forward(std::string(1000, 'a').c_str()));
+    CHECK(not_found.begin().is_end_position());
+    CHECK(not_found.end().is_end_position());
+}
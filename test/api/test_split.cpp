@@ -252,4 +252,28 @@ TEST_CASE("split_iterator advance test", "[split]")
         CHECK(!split_it.advance(3)); //end reached
         CHECK(std::string(split_it->begin(), split_it->end()) == "");
     }
-}
\ No newline at end of file
+}
+TEST_CASE("test split char_class", "[split]")
+{
+    cppstringx::utility::char_class separators(",; \t");
+    std::vector<std::string> container;
+    std::string text("a,b;c d\te,,f");
+    cppstringx::split(container, text, separators);
+    CHECK(container == std::vector<std::string>({ "a", "b", "c", "d", "e", "", "f" }));
+    cppstringx::split_chars(container, text, separators, cppstringx::split_mode::skip_empty);
+    CHECK(container == std::vector<std::string>({ "a", "b", "c", "d", "e", "f" }));
+    cppstringx::split_chars(container, text, ",; \t", cppstringx::split_mode::skip_empty);
+    CHECK(container == std::vector<std::string>({ "a", "b", "c", "d", "e", "f" }));
+
+    std::string long_text = std::string(40, 'x') + ";" + std::string(70, 'y') + ",";
+    auto split_it = cppstringx::make_split_chars_iterator(long_text, separators);
+    CHECK(std::string(split_it->begin(), split_it->end()) == std::string(40, 'x'));
+    CHECK(split_it.advance(1));
+    CHECK(std::string(split_it->begin(), split_it->end()) == std::string(70, 'y'));
+    CHECK(split_it.advance_to_last());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "");
+
+    std::vector<std::wstring> wide_container;
+    cppstringx::split_chars(wide_container, L"a\u0100b c", cppstringx::utility::char_class(L"\u0100 "));
+    CHECK(wide_container == std::vector<std::wstring>({ L"a", L"b", L"c" }));
+}
@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    // Collects the raw fields reported by a split_quoted_iterator.
+    template <typename text_type>
+    std::vector<std::string> split_fields(text_type& text, char separator, char quote = '"', char escape = '"', cppstringx::split_mode mode = cppstringx::split_mode::all)
+    {
+        std::vector<std::string> result;
+        for (auto split_it = cppstringx::make_split_quoted_iterator(text, separator, quote, escape, mode); !split_it.is_end_position(); ++split_it)
+        {
+            result.emplace_back(split_it->begin(), split_it->end());
+        }
+        return result;
+    }
+}
+
+TEST_CASE("test split_quoted_iterator", "[split_quoted]")
+{
+    std::string record = "42,\"Doe, John\",\"say \"\"hi\"\"\",,end";
+    CHECK(split_fields(record, ',') == std::vector<std::string>({ "42", "\"Doe, John\"", "\"say \"\"hi\"\"\"", "", "end" }));
+    CHECK(split_fields(record, ',', '"', '"', cppstringx::split_mode::skip_empty) == std::vector<std::string>({ "42", "\"Doe, John\"", "\"say \"\"hi\"\"\"", "end" }));
+
+    cppstringx::split_quoted_iterator<std::string> split_it(record, ',');
+    CHECK_FALSE(split_it.is_quoted());
+    CHECK(split_it.unquoted() == "42");
+    CHECK(split_it.advance(1));
+    CHECK(split_it.is_quoted());
+    CHECK(split_it.unquoted() == "Doe, John");
+    ++split_it;
+    CHECK(split_it.unquoted() == "say \"hi\"");
+    CHECK(split_it.advance_to_last());
+    CHECK(std::string(split_it->begin(), split_it->end()) == "end");
+    CHECK_FALSE(split_it.advance(1));
+    CHECK(split_it.is_end_position());
+
+    // Empty texts, separators at the start and end, and an unterminated quote.
+    std::string empty;
+    CHECK(split_fields(empty, ',') == std::vector<std::string>({ "" }));
+    CHECK(split_fields(empty, ',', '"', '"', cppstringx::split_mode::skip_empty).empty());
+    std::string separators = ",a,";
+    CHECK(split_fields(separators, ',') == std::vector<std::string>({ "", "a", "" }));
+    std::string unterminated = "a,\"b,c";
+    CHECK(split_fields(unterminated, ',') == std::vector<std::string>({ "a", "\"b,c" }));
+
+    // Null-terminated strings, lists and tab separated values with a backslash escape.
+    const char* p_text = "x\t'a\tb'\t'c\\'d'\te\\\tf";
+    CHECK(split_fields(p_text, '\t', '\'', '\\') == std::vector<std::string>({ "x", "'a\tb'", "'c\\'d'", "e\\\tf" }));
+    std::list<char> list(record.begin(), record.end());
+    CHECK(split_fields(list, ',').size() == 5);
+
+    CHECK_THROWS_AS(cppstringx::make_split_quoted_iterator(record, '"'), std::invalid_argument);
+    CHECK_THROWS_AS(cppstringx::make_split_quoted_iterator(record, ',', '\'', ','), std::invalid_argument);
+}
+
+TEST_CASE("test split_quoted_iterator records and unquote", "[split_quoted]")
+{
+    // Records may contain line breaks within quotes.
+    std::string text = "id,comment\n1,\"two\nlines\"\n2,\"a \"\"quoted\"\" word\"\n";
+    std::vector<std::vector<std::string>> table;
+    std::string value;
+    for (auto line_it = cppstringx::make_split_quoted_iterator(text, '\n', '"', '"', cppstringx::split_mode::skip_empty); !line_it.is_end_position(); ++line_it)
+    {
+        auto record = *line_it;
+        table.emplace_back();
+        for (auto field_it = cppstringx::make_split_quoted_iterator(record, ','); !field_it.is_end_position(); ++field_it)
+        {
+            value.clear();
+            table.back().push_back(cppstringx::append_unquoted(value, *field_it));
+        }
+    }
+    CHECK(table == std::vector<std::vector<std::string>>({ { "id", "comment" }, { "1", "two\nlines" }, { "2", "a \"quoted\" word" } }));
+
+    CHECK(cppstringx::unquote_copy("\"a,b\"") == "a,b");
+    CHECK(cppstringx::unquote_copy("\"\"") == "");
+    CHECK(cppstringx::unquote_copy("\"\"\"\"") == "\"");
+    CHECK(cppstringx::unquote_copy("plain") == "plain");
+    CHECK(cppstringx::unquote_copy("'it\\'s'", '\'', '\\') == "it's");
+    CHECK(cppstringx::unquote_copy("a\\\\b\\", '"', '\\') == "a\\b\\");
+    CHECK(cppstringx::unquote_copy(std::u16string(u"\"ä,ö\"")) == u"ä,ö");
+}
+
+TEST_CASE("test split_quoted_iterator agrees with the character wise implementation", "[split_quoted]")
+{
+    // The std::list is split character by character, the std::string and std::u32string using vector instructions if available.
+    std::mt19937 random(26);
+    const char alphabet[] = { 'a', 'b', ',', ',', '"', '\\' };
+    std::uniform_int_distribution<size_t> letter(0, sizeof(alphabet) - 1);
+    std::uniform_int_distribution<size_t> length(0, 200);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string text(length(random), 'a');
+        for (char& value : text)
+        {
+            value = alphabet[letter(random) % (i % 2 ? 6 : 5)];
+        }
+        const char escape = i % 2 ? '\\' : '"';
+        std::list<char> list(text.begin(), text.end());
+        const std::vector<std::string> expected = split_fields(list, ',', '"', escape);
+        CHECK(split_fields(text, ',', '"', escape) == expected);
+        const char* p_text = text.c_str();
+        CHECK(split_fields(p_text, ',', '"', escape) == expected);
+
+        std::u32string wide(text.begin(), text.end());
+        std::vector<std::string> wide_fields;
+        for (auto split_it = cppstringx::make_split_quoted_iterator(wide, U',', U'"', static_cast<char32_t>(escape)); !split_it.is_end_position(); ++split_it)
+        {
+            wide_fields.emplace_back(split_it->begin(), split_it->end());
+        }
+        CHECK(wide_fields == expected);
+    }
+}
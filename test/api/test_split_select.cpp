@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    template <typename iterator_type>
+    std::string to_string(const cppstringx::range<iterator_type>& field)
+    {
+        return std::string(field.begin(), field.end());
+    }
+}
+
+TEST_CASE("test split_select", "[split_select]")
+{
+    std::string line = "f0,f1,f2,,f4,f5,f6,f7,f8,f9,f10";
+    cppstringx::range<std::string::iterator> fields[3];
+    CHECK(cppstringx::split_select(fields, line, cppstringx::utility::char_class(","), { 2, 5, 9 }) == 3);
+    CHECK(to_string(fields[0]) == "f2");
+    CHECK(to_string(fields[1]) == "f5");
+    CHECK(to_string(fields[2]) == "f9");
+    *fields[0].begin() = 'F';
+    CHECK(line.substr(6, 2) == "F2");
+
+    // Empty sections are counted unless they are skipped.
+    const std::vector<size_t> columns = { 3, 4 };
+    CHECK(cppstringx::split_select(fields, line, cppstringx::utility::char_class(","), columns) == 2);
+    CHECK(to_string(fields[0]) == "");
+    CHECK(to_string(fields[1]) == "f4");
+    CHECK(cppstringx::split_select(fields, line, cppstringx::utility::char_class(","), columns, cppstringx::split_mode::skip_empty) == 2);
+    CHECK(to_string(fields[0]) == "f4");
+    CHECK(to_string(fields[1]) == "f5");
+
+    // Duplicate indices and indices behind the last section
+    std::array<cppstringx::range<std::string::iterator>, 4> more_fields;
+    CHECK(cppstringx::split_select(more_fields.begin(), line, cppstringx::utility::is_any_of<const char*>(","), { 0, 0, 10, 11 }) == 3);
+    CHECK(to_string(more_fields[0]) == "f0");
+    CHECK(to_string(more_fields[1]) == "f0");
+    CHECK(to_string(more_fields[2]) == "f10");
+    CHECK(more_fields[3].begin() == line.end());
+    CHECK(more_fields[3].end() == line.end());
+    CHECK(cppstringx::split_select(more_fields.begin(), line, cppstringx::utility::char_class(","), { 20, 30 }, cppstringx::split_mode::skip_empty) == 0);
+    CHECK(more_fields[0].begin() == line.end());
+
+    // Null-terminated strings and lists
+    const char* p_line = "a b  c";
+    cppstringx::range<const char*> c_fields[2];
+    CHECK(cppstringx::split_select(c_fields, p_line, cppstringx::utility::is_space(), { 1, 3 }) == 2);
+    CHECK(to_string(c_fields[0]) == "b");
+    CHECK(to_string(c_fields[1]) == "c");
+    const std::list<char> list_line(line.begin(), line.end());
+    cppstringx::range<std::list<char>::const_iterator> list_fields[1];
+    CHECK(cppstringx::split_select(list_fields, list_line, cppstringx::utility::char_class(","), { 10 }) == 1);
+    CHECK(to_string(list_fields[0]) == "f10");
+
+    std::string empty_line;
+    CHECK(cppstringx::split_select(fields, empty_line, cppstringx::utility::char_class(","), { 0, 1 }) == 1);
+    CHECK(cppstringx::split_select(fields, line, cppstringx::utility::char_class(","), std::vector<size_t>()) == 0);
+    CHECK_THROWS_AS(cppstringx::split_select(fields, line, cppstringx::utility::char_class(","), { 5, 2 }), std::invalid_argument);
+}
+
+TEST_CASE("test split_select stops at the highest index", "[split_select]")
+{
+    std::string line;
+    for (int i = 0; i < 40; ++i)
+    {
+        line += "field" + std::to_string(i) + ";";
+    }
+    size_t characters_read = 0;
+    auto is_separator = [&characters_read](char value) { ++characters_read; return value == ';'; };
+    cppstringx::range<std::string::iterator> fields[3];
+    CHECK(cppstringx::split_select(fields, line, is_separator, { 2, 5, 9 }) == 3);
+    CHECK(to_string(fields[2]) == "field9");
+    CHECK(characters_read == line.find("field10"));
+}
+
+TEST_CASE("test split_token_select", "[split_select]")
+{
+    std::string text = "a | b | c || d";
+    cppstringx::range<std::string::iterator> fields[2];
+    CHECK(cppstringx::split_token_select(fields, text, " | ", { 1, 2 }) == 2);
+    CHECK(to_string(fields[0]) == "b");
+    CHECK(to_string(fields[1]) == "c || d");
+    const std::vector<size_t> columns = { 0, 3 };
+    CHECK(cppstringx::split_token_select(fields, text, "|", columns, cppstringx::split_mode::skip_empty) == 2);
+    CHECK(to_string(fields[0]) == "a ");
+    CHECK(to_string(fields[1]) == " d");
+    CHECK(cppstringx::split_token_select(fields, text, "|", columns) == 2);
+    CHECK(to_string(fields[1]) == "");
+
+    std::string query = "x=1 AND y=2 and z=3";
+    CHECK(cppstringx::split_token_select(fields, query, " and ", { 1, 2 }, cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case()) == 2);
+    CHECK(to_string(fields[0]) == "y=2");
+    CHECK(to_string(fields[1]) == "z=3");
+    CHECK(cppstringx::split_token_select(fields, query, " and ", columns, cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case()) == 1);
+    CHECK(fields[1].begin() == query.end());
+
+    const cppstringx::searcher<char> separator("\r\n");
+    std::string lines = "l0\r\nl1\r\nl2";
+    CHECK(cppstringx::split_token_select(fields, lines, separator, { 2, 3 }) == 1);
+    CHECK(to_string(fields[0]) == "l2");
+    CHECK(fields[1].begin() == lines.end());
+
+    CHECK_THROWS_AS(cppstringx::split_token_select(fields, text, "", { 0 }), std::invalid_argument);
+    CHECK_THROWS_AS(cppstringx::split_token_select(fields, text, "|", { 1, 0 }), std::invalid_argument);
+}
+
+TEST_CASE("test split_select agrees with split", "[split_select]")
+{
+    std::mt19937 random(30);
+    std::uniform_int_distribution<int> letter(0, 3);
+    std::uniform_int_distribution<size_t> length(0, 80);
+    std::uniform_int_distribution<size_t> index(0, 12);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string text(length(random), 'a');
+        for (char& value : text)
+        {
+            value = "ab,;"[letter(random)];
+        }
+        std::vector<size_t> indices = { index(random), index(random), index(random) };
+        std::sort(indices.begin(), indices.end());
+        for (cppstringx::split_mode mode : { cppstringx::split_mode::all, cppstringx::split_mode::skip_empty })
+        {
+            std::vector<std::string> sections;
+            cppstringx::split(sections, text, cppstringx::utility::char_class(",;"), mode);
+            std::vector<std::string> token_sections;
+            cppstringx::split_token(token_sections, text, ",", mode);
+            std::array<cppstringx::range<std::string::iterator>, 3> fields;
+            std::array<cppstringx::range<std::string::iterator>, 3> token_fields;
+            size_t found = cppstringx::split_select(fields.begin(), text, cppstringx::utility::char_class(",;"), indices, mode);
+            size_t token_found = cppstringx::split_token_select(token_fields.begin(), text, ",", indices, mode);
+            size_t expected = 0;
+            size_t token_expected = 0;
+            for (size_t j = 0; j < indices.size(); ++j)
+            {
+                expected += indices[j] < sections.size() ? 1 : 0;
+                token_expected += indices[j] < token_sections.size() ? 1 : 0;
+                CHECK(to_string(fields[j]) == (indices[j] < sections.size() ? sections[indices[j]] : std::string()));
+                CHECK(to_string(token_fields[j]) == (indices[j] < token_sections.size() ? token_sections[indices[j]] : std::string()));
+            }
+            CHECK(found == expected);
+            CHECK(token_found == token_expected);
+        }
+    }
+}
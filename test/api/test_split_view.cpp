@@ -0,0 +1,106 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+
+namespace
+{
+    template <typename container_type>
+    std::vector<std::string> to_strings(const container_type& container)
+    {
+        std::vector<std::string> result;
+        for (auto& item : container)
+        {
+            result.emplace_back(item.begin(), item.end());
+        }
+        return result;
+    }
+}
+
+TEST_CASE("range_buffer", "[split_view]")
+{
+    std::string text("abcdefgh");
+    cppstringx::range_buffer<std::string::iterator, 2> buffer;
+    CHECK(buffer.empty());
+    CHECK(buffer.size() == 0);
+    CHECK(buffer.begin() == buffer.end());
+    buffer.emplace_back(text.begin(), text.begin() + 1);
+    buffer.push_back(cppstringx::range<std::string::iterator>(text.begin() + 1, text.begin() + 2));
+    CHECK(buffer.size() == 2);
+    CHECK(to_strings(buffer) == std::vector<std::string>({ "a", "b" }));
+
+    // more ranges than the inline capacity
+    buffer.emplace_back(text.begin() + 2, text.begin() + 4);
+    buffer.emplace_back(text.begin() + 4, text.end());
+    CHECK(buffer.size() == 4);
+    CHECK(to_strings(buffer) == std::vector<std::string>({ "a", "b", "cd", "efgh" }));
+    CHECK(std::string(buffer[3].begin(), buffer[3].end()) == "efgh");
+    CHECK(buffer.end() - buffer.begin() == 4);
+
+    cppstringx::range_buffer<std::string::iterator, 2> copied(buffer);
+    CHECK(to_strings(copied) == to_strings(buffer));
+
+    // reuse
+    buffer.clear();
+    CHECK(buffer.empty());
+    buffer.emplace_back(text.begin() + 7, text.end());
+    CHECK(to_strings(buffer) == std::vector<std::string>({ "h" }));
+    for (int i = 0; i < 3; ++i)
+    {
+        buffer.emplace_back(text.begin() + i, text.begin() + i + 1);
+    }
+    CHECK(to_strings(buffer) == std::vector<std::string>({ "h", "a", "b", "c" }));
+    CHECK(to_strings(copied) == std::vector<std::string>({ "a", "b", "cd", "efgh" }));
+}
+
+TEST_CASE("split_view", "[split_view]")
+{
+    cppstringx::split_buffer<std::string> fields;
+    std::string text("a,b;c,,d");
+    CHECK(to_strings(cppstringx::split_view(fields, text, cppstringx::utility::is_any_of<const char*>(",;"))) == std::vector<std::string>({ "a", "b", "c", "", "d" }));
+    CHECK(to_strings(cppstringx::split_chars_view(fields, text, ",;", cppstringx::split_mode::skip_empty)) == std::vector<std::string>({ "a", "b", "c", "d" }));
+    CHECK(fields[0].begin() == text.begin()); // the fields refer to the text
+
+    // reusing the buffer for more fields than the inline capacity
+    std::string long_text(40, ',');
+    CHECK(cppstringx::split_chars_view(fields, long_text, ",").size() == 41);
+    CHECK(cppstringx::split_chars_view(fields, text, ",").size() == 4);
+    CHECK(to_strings(fields) == std::vector<std::string>({ "a", "b;c", "", "d" }));
+
+    const std::string const_text("Hello World");
+    cppstringx::split_buffer<const std::string> const_fields;
+    CHECK(to_strings(cppstringx::split_view(const_fields, const_text, cppstringx::utility::is_space())) == std::vector<std::string>({ "Hello", "World" }));
+
+    std::vector<cppstringx::range<const char*>> pointer_fields;
+    const char* p_text = "Hello World";
+    CHECK(to_strings(cppstringx::split_chars_view(pointer_fields, p_text, " ")) == std::vector<std::string>({ "Hello", "World" }));
+
+    cppstringx::split_buffer<std::string, 1> token_fields;
+    std::string token_text("Hello - World - ");
+    CHECK(to_strings(cppstringx::split_token_view(token_fields, token_text, " - ")) == std::vector<std::string>({ "Hello", "World", "" }));
+    CHECK(to_strings(cppstringx::split_token_view(token_fields, token_text, " - ", cppstringx::split_mode::skip_empty)) == std::vector<std::string>({ "Hello", "World" }));
+    std::string itoken_text("HelloXxWorldxX");
+    CHECK(to_strings(cppstringx::split_token_view(token_fields, itoken_text, "xx", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case())) == std::vector<std::string>({ "Hello", "World", "" }));
+}
+
+TEST_CASE("count_fields", "[split_view]")
+{
+    std::string text("a,b;c,,d");
+    CHECK(cppstringx::count_fields(text, cppstringx::utility::is_any_of<const char*>(",;")) == 5);
+    CHECK(cppstringx::count_fields(text, cppstringx::utility::is_any_of<const char*>(",;"), cppstringx::split_mode::skip_empty) == 4);
+    CHECK(cppstringx::count_fields_chars(text, ",") == 4);
+    CHECK(cppstringx::count_fields_chars(text, "x") == 1);
+    CHECK(cppstringx::count_fields_chars("", ",") == 1);
+    CHECK(cppstringx::count_fields_chars("", ",", cppstringx::split_mode::skip_empty) == 0);
+    CHECK(cppstringx::count_fields_token(text, ",,") == 2);
+    CHECK(cppstringx::count_fields_token("Hello - World - ", " - ") == 3);
+    CHECK(cppstringx::count_fields_token("Hello - World - ", " - ", cppstringx::split_mode::skip_empty) == 2);
+    CHECK(cppstringx::count_fields_token("HelloXxWorld", "xx", cppstringx::split_mode::all, cppstringx::utility::equals_comparer_ignoring_case()) == 2);
+
+    std::vector<std::string> container;
+    cppstringx::split_chars(container, text, ",;");
+    CHECK(cppstringx::count_fields_chars(text, ",;") == container.size());
+}
@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+using cppstringx::utility::stats_family;
+
+TEST_CASE("test stats of the calling thread", "[stats]")
+{
+    const cppstringx::utility::stats_snapshot before = cppstringx::utility::stats_collect_thread();
+    CHECK(cppstringx::contains("Hello World", "World"));
+    CHECK_FALSE(cppstringx::contains("Hello World", "world"));
+    CHECK(cppstringx::iequals("Hello", "hELLO"));
+    CHECK(cppstringx::replace_all_copy(std::string("a-b-c"), "-", "+") == "a+b+c");
+    CHECK(cppstringx::to_upper_copy(std::string("abc")) == "ABC");
+    CHECK(cppstringx::trim_copy(std::string(" abc ")) == "abc");
+    std::vector<std::string> sections;
+    cppstringx::split_token(sections, "a,b,c", ",");
+    std::string joined;
+    cppstringx::join(joined, sections, ";");
+    const cppstringx::utility::stats_snapshot used = cppstringx::utility::stats_collect_thread() - before;
+
+    CHECK(used[stats_family::find].calls >= 2);
+    CHECK(used[stats_family::find].matches >= 1);
+    CHECK(used[stats_family::find].code_units >= 22);
+    CHECK(used[stats_family::compare].calls >= 1);
+    CHECK(used[stats_family::compare].matches >= 1);
+    CHECK(used[stats_family::replace].calls == 1);
+    CHECK(used[stats_family::replace].matches == 2);
+    CHECK(used[stats_family::replace].code_units == 5);
+    CHECK(used[stats_family::convert].calls == 1);
+    CHECK(used[stats_family::convert].code_units == 3);
+    CHECK(used[stats_family::trim].calls == 1);
+    CHECK(used[stats_family::split].calls == 1);
+    CHECK(used[stats_family::split].matches == 3);
+    CHECK(used[stats_family::split].allocations == 3);
+    CHECK(used[stats_family::join].calls == 1);
+    CHECK(used[stats_family::join].code_units == 5);
+}
+
+TEST_CASE("test stats collected from all threads", "[stats]")
+{
+    const cppstringx::utility::stats_snapshot before = cppstringx::utility::stats_collect();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                cppstringx::to_lower_copy(std::string("ABCD"));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const cppstringx::utility::stats_snapshot used = cppstringx::utility::stats_collect() - before;
+    CHECK(used[stats_family::convert].calls == 400);
+    CHECK(used[stats_family::convert].code_units == 1600);
+    CHECK(used[stats_family::convert].allocations == 400);
+}
+
+TEST_CASE("test stats export", "[stats]")
+{
+    cppstringx::utility::stats_snapshot snapshot;
+    snapshot[stats_family::find].calls = 42;
+    snapshot[stats_family::join].nanoseconds = 7;
+    std::ostringstream metrics;
+    snapshot.write_prometheus(metrics, "app_strings");
+    CHECK(cppstringx::contains(metrics.str(), "# TYPE app_strings_calls_total counter\n"));
+    CHECK(cppstringx::contains(metrics.str(), "app_strings_calls_total{family=\"find\"} 42\n"));
+    CHECK(cppstringx::contains(metrics.str(), "app_strings_nanoseconds_total{family=\"join\"} 7\n"));
+    size_t family_count = 0;
+    snapshot.for_each([&family_count](const char* family, const cppstringx::utility::stats_counters& counters)
+    {
+        ++family_count;
+        if (cppstringx::equals(family, "find"))
+        {
+            CHECK(counters.calls == 42);
+        }
+    });
+    CHECK(family_count == static_cast<size_t>(cppstringx::utility::stats_snapshot::family_count));
+    snapshot += snapshot;
+    CHECK(snapshot[stats_family::find].calls == 84);
+    CHECK(std::string(cppstringx::utility::stats_family_name(stats_family::split)) == "split");
+}
+
+TEST_CASE("test stats of the parallel functions", "[stats]")
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+    {
+        text += "ab,cd;";
+    }
+    const cppstringx::utility::stats_snapshot before = cppstringx::utility::stats_collect();
+    std::vector<std::string> sections;
+    cppstringx::parallel_split(cppstringx::utility::parallel_policy(4, 64), sections, text, cppstringx::utility::char_class(","));
+    cppstringx::parallel_split_chars(cppstringx::utility::parallel_policy(4, 64), sections, text, ",;");
+    cppstringx::parallel_split_token(cppstringx::utility::parallel_policy(4, 64), sections, text, ";");
+    CHECK(cppstringx::parallel_replace_all_copy(cppstringx::utility::parallel_policy(4, 64), text, ",", "") == cppstringx::replace_all_copy(text, ",", ""));
+    const cppstringx::utility::stats_snapshot used = cppstringx::utility::stats_collect() - before;
+
+    CHECK(used[stats_family::split].calls == 3);
+    CHECK(used[stats_family::split].matches == 101 + 201 + 101);
+    CHECK(used[stats_family::split].allocations == 101 + 201 + 101);
+    CHECK(used[stats_family::replace].calls == 2);
+    CHECK(used[stats_family::replace].matches == 200);
+    CHECK(used[stats_family::replace].code_units == 1200);
+    CHECK(used[stats_family::replace].allocations == 2);
+}
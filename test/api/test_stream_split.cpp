@@ -0,0 +1,151 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <cppstringx/cppstringx.hpp>
+#include <vector>
+#include <sstream>
+#include <random>
+
+namespace
+{
+    // Collects the sections of a stream_split_token_iterator, joins the parts of sections not fitting into the buffer.
+    template <typename iterator_type>
+    std::vector<std::string> collect_sections(iterator_type&& split_it, size_t& part_count)
+    {
+        std::vector<std::string> result;
+        std::string section;
+        part_count = 0;
+        for (; !split_it.is_end_position(); ++split_it)
+        {
+            section.append(split_it->begin(), split_it->end());
+            ++part_count;
+            if (!split_it.is_partial())
+            {
+                result.push_back(section);
+                section.clear();
+            }
+        }
+        return result;
+    }
+
+    template <typename iterator_type>
+    std::vector<std::string> collect_sections(iterator_type&& split_it)
+    {
+        size_t part_count = 0;
+        return collect_sections(std::forward<iterator_type>(split_it), part_count);
+    }
+}
+
+TEST_CASE("stream_split_token_iterator", "[stream_split]")
+{
+    {
+        std::istringstream input("GET / HTTP/1.1\r\nHost: example.com\r\n\r\nbody");
+        auto split_it = cppstringx::make_stream_split_token_iterator(input, "\r\n");
+        REQUIRE(!split_it.is_end_position());
+        CHECK(cppstringx::copy<std::string>(*split_it) == "GET / HTTP/1.1");
+        CHECK(!split_it.is_partial());
+        ++split_it;
+        CHECK(cppstringx::copy<std::string>(*split_it) == "Host: example.com");
+        ++split_it;
+        CHECK(split_it->begin() == split_it->end());
+        ++split_it;
+        CHECK(cppstringx::copy<std::string>(*split_it) == "body");
+        ++split_it;
+        CHECK(split_it.is_end_position());
+    }
+
+    // empty input
+    {
+        std::istringstream input;
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input, ",")) == std::vector<std::string>{ "" });
+        std::istringstream input_skip;
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input_skip, ",", cppstringx::split_mode::skip_empty)).empty());
+    }
+
+    // skip empty sections
+    {
+        std::istringstream input(",,a,,b,");
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input, ",", cppstringx::split_mode::skip_empty)) == std::vector<std::string>{ "a", "b" });
+        std::istringstream input_all(",,a,,b,");
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input_all, ",")) == std::vector<std::string>{ "", "", "a", "", "b", "" });
+    }
+
+    // case-insensitive comparer
+    {
+        std::istringstream input("aXyZbxyzc");
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input, "xyz", cppstringx::split_mode::all, cppstringx::utility::equals_comparer_ignoring_case(), 4))
+            == std::vector<std::string>{ "a", "b", "c" });
+    }
+
+    // wide streams
+    {
+        std::wistringstream input(L"a;b");
+        auto split_it = cppstringx::make_stream_split_token_iterator(input, ";");
+        CHECK(cppstringx::copy<std::wstring>(*split_it) == L"a");
+        ++split_it;
+        CHECK(cppstringx::copy<std::wstring>(*split_it) == L"b");
+        ++split_it;
+        CHECK(split_it.is_end_position());
+    }
+
+    // sections longer than the buffer are returned in parts
+    {
+        std::istringstream input("0123456789--abc--0123456789");
+        size_t part_count = 0;
+        CHECK(collect_sections(cppstringx::make_stream_split_token_iterator(input, "--", cppstringx::split_mode::all, cppstringx::utility::equals_comparer(), 4), part_count)
+            == std::vector<std::string>{ "0123456789", "abc", "0123456789" });
+        CHECK(part_count > 3);
+    }
+
+    // a reader reading from a custom source
+    {
+        const std::string source("one two  three");
+        size_t source_position = 0;
+        auto reader = [&](char* p_buffer, size_t size) {
+            size_t result = std::min<size_t>(std::min<size_t>(size, 3), source.size() - source_position);
+            std::copy(source.begin() + static_cast<std::ptrdiff_t>(source_position), source.begin() + static_cast<std::ptrdiff_t>(source_position + result), p_buffer);
+            source_position += result;
+            return result;
+        };
+        CHECK(collect_sections(cppstringx::make_stream_split_token_reader_iterator(reader, " ", cppstringx::split_mode::skip_empty, cppstringx::utility::equals_comparer(), 8))
+            == std::vector<std::string>{ "one", "two", "three" });
+    }
+
+    // invalid arguments
+    {
+        std::istringstream input("abc");
+        CHECK_THROWS_AS(cppstringx::make_stream_split_token_iterator(input, ""), std::invalid_argument);
+        CHECK_THROWS_AS(cppstringx::make_stream_split_token_iterator(input, "abc", cppstringx::split_mode::all, cppstringx::utility::equals_comparer(), 2), std::invalid_argument);
+    }
+}
+
+TEST_CASE("stream_split_token_iterator compared to split_token", "[stream_split]")
+{
+    std::minstd_rand random(11);
+    for (int round = 0; round < 200; ++round)
+    {
+        std::string text(random() % 60, 'a');
+        for (char& c : text)
+        {
+            c = static_cast<char>('a' + random() % 3);
+        }
+        std::string separator(1 + random() % 3, 'a');
+        for (char& c : separator)
+        {
+            c = static_cast<char>('a' + random() % 3);
+        }
+        const cppstringx::split_mode mode = round % 2 == 0 ? cppstringx::split_mode::all : cppstringx::split_mode::skip_empty;
+        std::vector<std::string> expected;
+        cppstringx::split_token(expected, text, separator, mode);
+
+        // separators straddle chunk borders for every buffer size
+        for (size_t buffer_size = separator.size(); buffer_size < separator.size() + 8; ++buffer_size)
+        {
+            std::istringstream input(text);
+            std::vector<std::string> sections = collect_sections(cppstringx::make_stream_split_token_iterator(input, separator, mode, cppstringx::utility::equals_comparer(), buffer_size));
+            CHECK(sections == expected);
+        }
+    }
+}
@@ -4,6 +4,8 @@
 //-----------------------------------------------------------------------------
 #include <catch2/catch.hpp>
 #include <cppstringx/cppstringx.hpp>
+#include <string>
+#include <vector>
 
 TEST_CASE("test string_length", "[string_length]")
 {
@@ -38,3 +40,86 @@ TEST_CASE("test string_length", "[string_length]")
         CHECK(cppstringx::string_length(text) == 0);
     }
 }
+
+TEST_CASE("test string_length of 16 bit and 32 bit code units", "[string_length]")
+{
+    //every length at every offset in a buffer, the code units are scanned in aligned blocks
+    {
+        std::vector<char16_t> buffer16(200, u'a');
+        std::vector<char32_t> buffer32(200, U'a');
+        for (size_t offset = 0; offset < 40; ++offset)
+        {
+            for (size_t length = 0; length < 120; ++length)
+            {
+                buffer16[offset + length] = 0;
+                buffer32[offset + length] = 0;
+                CHECK(cppstringx::string_length(buffer16.data() + offset) == length);
+                CHECK(cppstringx::string_length(static_cast<const char32_t*>(buffer32.data() + offset)) == length);
+                buffer16[offset + length] = u'a';
+                buffer32[offset + length] = U'a';
+            }
+        }
+    }
+    //code units with a zero byte are not a terminating null
+    {
+        CHECK(cppstringx::string_length(u"ĀȀ\u0001") == 3);
+        CHECK(cppstringx::string_length(U"\U00010000Ā\u0001") == 3);
+    }
+}
+
+TEST_CASE("test sized_c_string", "[string_length]")
+{
+    //a known length, the string does not need to be null-terminated
+    {
+        const char16_t text[] = { u'H', u'e', u'l', u'l', u'o', u' ', u'W', u'o', u'r', u'l', u'd' };
+        auto sized = cppstringx::sized_c_string(text, 11);
+        CHECK(sized.end() - sized.begin() == 11);
+        CHECK(cppstringx::ends_with(sized, u"World"));
+        CHECK(cppstringx::starts_with(sized, u"Hello"));
+        CHECK(cppstringx::contains(sized, u"o W"));
+        CHECK(cppstringx::equals(cppstringx::sized_c_string(text, 5), u"Hello"));
+        CHECK(cppstringx::equals(cppstringx::trim_end_copy(cppstringx::sized_c_string(text, 6), [](char16_t c) { return c == u' '; }), u"Hello"));
+    }
+    //the length is determined once
+    {
+        auto sized = cppstringx::sized_c_string("a,b,c");
+        CHECK(sized.end() - sized.begin() == 5);
+        std::vector<std::string> fields;
+        cppstringx::split_token(fields, sized, ",");
+        CHECK(fields == std::vector<std::string>({ "a", "b", "c" }));
+    }
+    //a mutable buffer
+    {
+        char buffer[] = "Hello";
+        cppstringx::range<char*> sized = cppstringx::sized_c_string(buffer);
+        CHECK(sized.end() - sized.begin() == 5);
+        CHECK(cppstringx::sized_c_string(buffer, 0).end() == buffer);
+    }
+}
+
+TEST_CASE("test searching null-terminated texts", "[string_length]")
+{
+    // The searches read a null-terminated text up to the match only, the results equal those of a text of known size.
+    std::string text;
+    for (int i = 0; i < 500; ++i)
+    {
+        text += std::string(static_cast<size_t>(i % 37), 'x') + (i % 2 ? ", " : ", sk, ");
+    }
+    const char* p_text = text.c_str();
+    std::vector<std::string> expected;
+    std::vector<std::string> sections;
+    cppstringx::split_token(expected, text, ", ");
+    cppstringx::split_token(sections, p_text, ", ");
+    CHECK(sections == expected);
+    cppstringx::split_token(sections, p_text, cppstringx::make_searcher(", "));
+    CHECK(sections == expected);
+    cppstringx::split_token(sections, p_text, cppstringx::make_literal_pattern(", "));
+    CHECK(sections == expected);
+    cppstringx::split_token(sections, p_text, ", ", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case());
+    CHECK(sections == expected);
+
+    cppstringx::split_token(expected, text, ", SK, ", cppstringx::split_mode::all, cppstringx::utility::ascii_equals_comparer_ignoring_case());
+    cppstringx::split_token(sections, p_text, ", SK, ", cppstringx::split_mode::all, cppstringx::utility::unicode_equals_comparer_ignoring_case());
+    CHECK(sections == expected);
+    CHECK(cppstringx::count(p_text, "sk") == 250);
+}
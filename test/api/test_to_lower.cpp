@@ -58,3 +58,73 @@ TEST_CASE("test to_lower_in_place", "[to_lower]")
         CHECK(cppstringx::character_convert_in_place(buffer, [](char a) { if (a == 'A') return 'a'; return a; }) == buffer);
     }
 }
+
+TEST_CASE("test to_lower ascii_case and latin1_case", "[to_lower]")
+{
+    CHECK(cppstringx::to_lower_copy(std::string("AxByCz"), cppstringx::utility::ascii_case()) == "axbycz");
+    CHECK(cppstringx::to_lower_copy(std::u16string(u"AxByCz"), cppstringx::utility::ascii_case()) == u"axbycz");
+    CHECK(cppstringx::to_lower_copy(std::string(""), cppstringx::utility::ascii_case()) == "");
+    CHECK(cppstringx::to_lower_copy(std::string("\xC0\xD7\xDE\xDF"), cppstringx::utility::ascii_case()) == "\xC0\xD7\xDE\xDF");
+    CHECK(cppstringx::to_lower_copy(std::string("\xC0\xD7\xDE\xDF"), cppstringx::utility::latin1_case()) == "\xE0\xD7\xFE\xDF");
+    CHECK(cppstringx::to_lower_copy(std::wstring(L"\xC0\xD7\xDE\xDF"), cppstringx::utility::latin1_case()) == L"\xE0\xD7\xFE\xDF");
+    {
+        std::string text("AxByCz");
+        CHECK(&cppstringx::to_lower_in_place(text, cppstringx::utility::ascii_case()) == &text);
+        CHECK(text == "axbycz");
+    }
+    {
+        char buffer[] = { "AxByCz" };
+        CHECK(cppstringx::to_lower_in_place(static_cast<char*>(buffer), cppstringx::utility::ascii_case()) == buffer);
+        CHECK(std::string(buffer) == "axbycz");
+    }
+    {
+        std::string text("AxByCz");
+        cppstringx::range<std::string::iterator> r(text.begin() + 2, text.end());
+        CHECK(&cppstringx::to_lower_in_place(r, cppstringx::utility::latin1_case()) == &r);
+        CHECK(text == std::string("Ax") + std::string("axbycz").substr(2));
+    }
+
+    // all code units and sizes around the vector block sizes, compared to the character-wise conversion
+    std::string all_code_units;
+    for (int value = 0; value < 256; ++value)
+    {
+        all_code_units.push_back(static_cast<char>(value));
+    }
+    cppstringx::utility::ascii_to_lower_case_converter ascii_converter;
+    cppstringx::utility::latin1_to_lower_case_converter latin1_converter;
+    for (size_t size = 0; size <= all_code_units.size(); size += (size < 70 ? 1 : 31))
+    {
+        std::string text = all_code_units.substr(256 - size);
+        std::string expected_ascii;
+        std::string expected_latin1;
+        for (char code_unit : text)
+        {
+            expected_ascii.push_back(ascii_converter(code_unit));
+            expected_latin1.push_back(latin1_converter(code_unit));
+        }
+        CHECK(cppstringx::to_lower_copy(text, cppstringx::utility::ascii_case()) == expected_ascii);
+        CHECK(cppstringx::to_lower_copy(text, cppstringx::utility::latin1_case()) == expected_latin1);
+        std::string text_in_place(text);
+        CHECK(cppstringx::to_lower_in_place(text_in_place, cppstringx::utility::latin1_case()) == expected_latin1);
+        std::u32string text32;
+        std::u32string expected32;
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            text32.push_back(static_cast<unsigned char>(text[i]));
+            expected32.push_back(static_cast<unsigned char>(expected_latin1[i]));
+        }
+        CHECK(cppstringx::to_lower_in_place(text32, cppstringx::utility::latin1_case()) == expected32);
+    }
+}
+
+TEST_CASE("test to_lower cached_locale_case", "[to_lower]")
+{
+    CHECK(cppstringx::to_lower_copy(std::string("AxByCz"), cppstringx::utility::cached_locale_case()) == "axbycz");
+    CHECK(cppstringx::to_lower_copy(std::wstring(L"AxByCz"), cppstringx::utility::cached_locale_case()) == L"axbycz");
+    CHECK(cppstringx::to_upper_copy(std::string("AxByCz"), cppstringx::utility::cached_locale_case()) == "AXBYCZ");
+    std::string text("Hello World");
+    CHECK(cppstringx::to_lower_in_place(text, cppstringx::utility::cached_locale_case()) == "hello world");
+    CHECK(cppstringx::iequals(text, "HELLO world"));
+    CHECK(cppstringx::icontains(std::wstring(L"Hello World"), L"O w"));
+    CHECK(cppstringx::ireplace_all_copy(text, "L", "_") == "he__o wor_d");
+}
@@ -58,3 +58,61 @@ TEST_CASE("test to_upper_in_place", "[to_upper]")
         CHECK(cppstringx::character_convert_in_place(buffer, [](char a) { if (a == 'y') return 'Y'; return a; }) == buffer);
     }
 }
+
+TEST_CASE("test to_upper ascii_case and latin1_case", "[to_upper]")
+{
+    CHECK(cppstringx::to_upper_copy(std::string("aXbYcZ"), cppstringx::utility::ascii_case()) == "AXBYCZ");
+    CHECK(cppstringx::to_upper_copy(std::u16string(u"aXbYcZ"), cppstringx::utility::ascii_case()) == u"AXBYCZ");
+    CHECK(cppstringx::to_upper_copy(std::string(""), cppstringx::utility::ascii_case()) == "");
+    CHECK(cppstringx::to_upper_copy(std::string("\xE0\xF7\xFE\xFF"), cppstringx::utility::ascii_case()) == "\xE0\xF7\xFE\xFF");
+    CHECK(cppstringx::to_upper_copy(std::string("\xE0\xF7\xFE\xFF"), cppstringx::utility::latin1_case()) == "\xC0\xF7\xDE\xFF");
+    CHECK(cppstringx::to_upper_copy(std::wstring(L"\xE0\xF7\xFE\xFF"), cppstringx::utility::latin1_case()) == L"\xC0\xF7\xDE\xFF");
+    {
+        std::string text("aXbYcZ");
+        CHECK(&cppstringx::to_upper_in_place(text, cppstringx::utility::ascii_case()) == &text);
+        CHECK(text == "AXBYCZ");
+    }
+    {
+        char buffer[] = { "aXbYcZ" };
+        CHECK(cppstringx::to_upper_in_place(static_cast<char*>(buffer), cppstringx::utility::ascii_case()) == buffer);
+        CHECK(std::string(buffer) == "AXBYCZ");
+    }
+    {
+        std::string text("aXbYcZ");
+        cppstringx::range<std::string::iterator> r(text.begin() + 2, text.end());
+        CHECK(&cppstringx::to_upper_in_place(r, cppstringx::utility::latin1_case()) == &r);
+        CHECK(text == std::string("aX") + std::string("AXBYCZ").substr(2));
+    }
+
+    // all code units and sizes around the vector block sizes, compared to the character-wise conversion
+    std::string all_code_units;
+    for (int value = 0; value < 256; ++value)
+    {
+        all_code_units.push_back(static_cast<char>(value));
+    }
+    cppstringx::utility::ascii_to_upper_case_converter ascii_converter;
+    cppstringx::utility::latin1_to_upper_case_converter latin1_converter;
+    for (size_t size = 0; size <= all_code_units.size(); size += (size < 70 ? 1 : 31))
+    {
+        std::string text = all_code_units.substr(256 - size);
+        std::string expected_ascii;
+        std::string expected_latin1;
+        for (char code_unit : text)
+        {
+            expected_ascii.push_back(ascii_converter(code_unit));
+            expected_latin1.push_back(latin1_converter(code_unit));
+        }
+        CHECK(cppstringx::to_upper_copy(text, cppstringx::utility::ascii_case()) == expected_ascii);
+        CHECK(cppstringx::to_upper_copy(text, cppstringx::utility::latin1_case()) == expected_latin1);
+        std::string text_in_place(text);
+        CHECK(cppstringx::to_upper_in_place(text_in_place, cppstringx::utility::latin1_case()) == expected_latin1);
+        std::u32string text32;
+        std::u32string expected32;
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            text32.push_back(static_cast<unsigned char>(text[i]));
+            expected32.push_back(static_cast<unsigned char>(expected_latin1[i]));
+        }
+        CHECK(cppstringx::to_upper_in_place(text32, cppstringx::utility::latin1_case()) == expected32);
+    }
+}
@@ -136,3 +136,23 @@ TEST_CASE("test trim predicate", "[trim]")
         CHECK(text == "Hello Worl");
     }
 }
+
+TEST_CASE("test trim char_class", "[trim]")
+{
+    cppstringx::utility::char_class trimmed_characters(" \t\r\n");
+    CHECK(cppstringx::trim_copy(std::string(" \t Hello World\r\n"), trimmed_characters) == "Hello World");
+    CHECK(cppstringx::trim_copy(std::wstring(L" \t Hello World\r\n"), trimmed_characters) == L"Hello World");
+    CHECK(cppstringx::trim_copy(std::string(" \t \r\n"), trimmed_characters) == "");
+    CHECK(cppstringx::trim_copy(std::string(100, ' ') + "Hello World" + std::string(100, '\t'), trimmed_characters) == "Hello World");
+    CHECK(cppstringx::trim_start_copy(std::string(40, ' ') + "x" + std::string(40, ' '), trimmed_characters) == "x" + std::string(40, ' '));
+    CHECK(cppstringx::trim_end_copy(std::string(40, ' ') + "x" + std::string(40, ' '), trimmed_characters) == std::string(40, ' ') + "x");
+    {
+        std::string text(std::string(33, '\n') + "Hello World" + std::string(65, ' '));
+        CHECK(cppstringx::trim_in_place(text, trimmed_characters) == "Hello World");
+        CHECK(text == "Hello World");
+    }
+    {
+        char text[] = { "  Hello World  " };
+        CHECK(std::string(cppstringx::trim_in_place(static_cast<char*>(text), trimmed_characters)) == "Hello World");
+    }
+}
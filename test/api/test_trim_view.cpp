@@ -0,0 +1,135 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    // Checks whether trim_view() accepts a text of the type, temporary string objects are rejected.
+    template <typename text_type>
+    auto accepts_trim_view(int) -> decltype(cppstringx::trim_view(std::declval<text_type>()), cppstringx::trim_start_view(std::declval<text_type>()), cppstringx::trim_end_view(std::declval<text_type>(), cppstringx::utility::is_space()), std::true_type());
+    template <typename text_type>
+    std::false_type accepts_trim_view(...);
+}
+
+TEST_CASE("test trim_view", "[trim_view]")
+{
+    //string objects
+    {
+        const std::string text(" \t Hello World \n");
+        cppstringx::range<std::string::const_iterator> trimmed = cppstringx::trim_view(text);
+        CHECK(cppstringx::copy<std::string>(trimmed) == "Hello World");
+        CHECK(trimmed.begin() == text.begin() + 3);
+        CHECK(cppstringx::copy<std::string>(cppstringx::trim_start_view(text)) == "Hello World \n");
+        CHECK(cppstringx::copy<std::string>(cppstringx::trim_end_view(text)) == " \t Hello World");
+        CHECK(cppstringx::copy<std::string>(cppstringx::trim_view(text, [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == 'H' || c == 'd'; })) == "ello Worl");
+        const std::wstring wide_text(L" Hello ");
+        CHECK(cppstringx::copy<std::wstring>(cppstringx::trim_view(wide_text)).size() == 5);
+    }
+    //null-terminated strings and range objects
+    {
+        const char* text = "  Hello World  ";
+        cppstringx::range<const char*> trimmed = cppstringx::trim_view(text);
+        CHECK(trimmed.begin() == text + 2);
+        CHECK(trimmed.end() == text + 13);
+        CHECK(cppstringx::equals(cppstringx::trim_start_view(text), "Hello World  "));
+        CHECK(cppstringx::equals(cppstringx::trim_end_view(text), "  Hello World"));
+        CHECK(cppstringx::equals(cppstringx::trim_view(u"  Hello  ", cppstringx::utility::char_class(u" ")), u"Hello"));
+        CHECK(cppstringx::equals(cppstringx::trim_view(cppstringx::sized_c_string(text, 8)), "Hello"));
+    }
+    //empty results
+    {
+        CHECK(cppstringx::equals(cppstringx::trim_view(""), ""));
+        CHECK(cppstringx::equals(cppstringx::trim_view("   "), ""));
+        const std::string spaces("   ");
+        CHECK(cppstringx::equals(cppstringx::trim_start_view(spaces), ""));
+        CHECK(cppstringx::equals(cppstringx::trim_end_view(spaces), ""));
+    }
+    //trimming each field of a line without copying
+    {
+        const std::string line(" 1 ,  22,333  ");
+        std::vector<cppstringx::range<std::string::const_iterator>> fields;
+        cppstringx::split_token(fields, line, ",");
+        std::vector<std::string> trimmed;
+        for (auto& field : fields)
+        {
+            trimmed.push_back(cppstringx::copy<std::string>(cppstringx::trim_view(field)));
+        }
+        CHECK(trimmed == std::vector<std::string>({ "1", "22", "333" }));
+    }
+}
+
+TEST_CASE("test trim_view rejecting temporary strings", "[trim_view]")
+{
+    CHECK_FALSE(decltype(accepts_trim_view<std::string>(0))::value);
+    CHECK_FALSE(decltype(accepts_trim_view<const std::u16string>(0))::value);
+    CHECK(decltype(accepts_trim_view<const std::string&>(0))::value);
+    CHECK(decltype(accepts_trim_view<const char*>(0))::value);
+    CHECK(decltype(accepts_trim_view<cppstringx::range<const char*>>(0))::value);
+#if defined(CPPSTRINGX_STRING_VIEW)
+    CHECK(decltype(accepts_trim_view<std::string_view>(0))::value);
+#endif
+}
+
+TEST_CASE("test trim_in_place moving the text to the front", "[trim_view]")
+{
+    std::string text(100, ' ');
+    text += "Hello World";
+    text += std::string(50, ' ');
+    cppstringx::trim_in_place(text);
+    CHECK(text == "Hello World");
+    std::u32string text32(U"   Hello   ");
+    cppstringx::trim_start_in_place(text32, [](char32_t c) { return c == U' '; });
+    CHECK(text32 == U"Hello   ");
+}
+
+#if defined(CPPSTRINGX_STRING_VIEW)
+TEST_CASE("test string_view", "[trim_view]")
+{
+    //trim_view returns string views for string views
+    {
+        std::string_view text(" \t Hello World \n");
+        std::string_view trimmed = cppstringx::trim_view(text);
+        CHECK(trimmed == "Hello World");
+        CHECK(trimmed.data() == text.data() + 3);
+        CHECK(cppstringx::trim_start_view(text) == "Hello World \n");
+        CHECK(cppstringx::trim_end_view(text) == " \t Hello World");
+        CHECK(cppstringx::trim_view(std::string_view("   ")).empty());
+        CHECK(cppstringx::trim_view(std::u16string_view(u" x "), cppstringx::utility::char_class(u" ")) == u"x");
+    }
+    //trim_copy and trim_in_place
+    {
+        std::string_view text("  Hello  ");
+        std::string_view copy = cppstringx::trim_copy(text);
+        CHECK(copy == "Hello");
+        CHECK(cppstringx::trim_end_copy(text) == "  Hello");
+        cppstringx::trim_start_in_place(text);
+        CHECK(text == "Hello  ");
+    }
+    //other functions
+    {
+        std::string_view text("a, b,,c");
+        CHECK(cppstringx::contains(text, ", b"));
+        CHECK(cppstringx::starts_with(text, std::string_view("a,")));
+        CHECK(cppstringx::ends_with(text, ",c"));
+        CHECK(cppstringx::iequals(text, "A, B,,C"));
+        std::vector<std::string_view> sections;
+        cppstringx::split_token(sections, text, ",");
+        CHECK(sections == std::vector<std::string_view>({ "a", " b", "", "c" }));
+        cppstringx::split_chars(sections, text, ", ", cppstringx::split_mode::skip_empty);
+        CHECK(sections == std::vector<std::string_view>({ "a", "b", "c" }));
+        std::string line(" 1 ,  22,333  ");
+        std::vector<std::string_view> fields;
+        cppstringx::split_token(fields, line, ",");
+        for (auto& field : fields)
+        {
+            cppstringx::trim_in_place(field);
+        }
+        CHECK(fields == std::vector<std::string_view>({ "1", "22", "333" }));
+        CHECK(cppstringx::replace_all_copy(std::string(text), std::string_view(","), std::string_view(";")) == "a; b;;c");
+    }
+}
+#endif
@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+//  cppstringx tests
+//  Copyright (c) 2022 Andreas Gau
+//-----------------------------------------------------------------------------
+#include <catch2/catch.hpp>
+#include <list>
+#include <random>
+#include <vector>
+#include <cppstringx/cppstringx.hpp>
+
+namespace
+{
+    const cppstringx::utility::unicode_equals_comparer_ignoring_case unicode_comparer;
+}
+
+TEST_CASE("test unicode comparer equals", "[unicode_case]")
+{
+    // UTF-8: "straße" and "STRAẞE", the capital sharp s folds to the sharp s.
+    CHECK(cppstringx::iequals(std::string("stra\xC3\x9F" "e"), "STRA\xE1\xBA\x9E" "E", unicode_comparer));
+    // The full case folding of the sharp s to "ss" is not applied.
+    CHECK_FALSE(cppstringx::iequals(std::string("stra\xC3\x9F" "e"), "STRASSE", unicode_comparer));
+    CHECK(cppstringx::iequals(std::u16string(u"ΟΔΥΣΣΕΥΣ"), u"οδυσσευς", unicode_comparer));
+    CHECK(cppstringx::iequals(std::u32string(U"ПРИВЕТ"), U"привет", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::u16string(u"ПРИВЕТ"), u"привед", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::u16string(u"ПРИВЕТ"), u"приве", unicode_comparer));
+
+    // Different code unit types: UTF-8 "Привет" and UTF-16, UTF-32.
+    CHECK(cppstringx::iequals("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", u"ПРИВЕТ", unicode_comparer));
+    CHECK(cppstringx::iequals(std::u16string(u"ПРИВЕТ"), U"привет", unicode_comparer));
+
+    // Surrogate pairs: DESERET CAPITAL LETTER LONG I and DESERET SMALL LETTER LONG I.
+    CHECK(cppstringx::iequals(std::u16string(u"a\U00010400b"), u"A\U00010428B", unicode_comparer));
+    CHECK(cppstringx::iequals("\xF0\x90\x90\x80", U"\U00010428", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::u16string(u"\U00010400"), u"\U00010401", unicode_comparer));
+
+    // The Kelvin sign is encoded using three code units in UTF-8.
+    CHECK(cppstringx::iequals(std::string("\xE2\x84\xAA" "elvin"), "kelvin", unicode_comparer));
+    CHECK(cppstringx::iequals(std::list<char>({ 'K', 'E', 'L', 'V', 'I', 'N' }), "\xE2\x84\xAA" "elvin", unicode_comparer));
+
+    // Invalid sequences are compared code unit by code unit.
+    CHECK(cppstringx::iequals(std::string("a\xC3"), "A\xC3", unicode_comparer));
+    CHECK(cppstringx::iequals(std::string("\xC3" "A"), "\xC3" "a", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::string("\xFF"), "\xFE", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::string("\xC3"), "\xC3\xA4", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::u16string(u"\xD800" u"a"), u"\xD801" u"a", unicode_comparer));
+
+    CHECK(cppstringx::iequals(std::string(), "", unicode_comparer));
+    CHECK_FALSE(cppstringx::iequals(std::string(), "a", unicode_comparer));
+}
+
+TEST_CASE("test unicode comparer starts_with and ends_with", "[unicode_case]")
+{
+    const std::string text("\xC3\x84pfel und Birnen");
+    CHECK(cppstringx::istarts_with(text, "\xC3\xA4PFEL", unicode_comparer));
+    CHECK(cppstringx::istarts_with("\xE2\x84\xAA" "elvin", "kel", unicode_comparer));
+    CHECK_FALSE(cppstringx::istarts_with(text, "\xC3\xA4PFEL und birnen!", unicode_comparer));
+    CHECK_FALSE(cppstringx::istarts_with("\xC3\x9F", "s", unicode_comparer));
+    CHECK(cppstringx::istarts_with(std::list<char>(text.begin(), text.end()), "\xC3\xA4PFEL", unicode_comparer));
+
+    // The endings are compared reading the strings in reverse order.
+    CHECK(cppstringx::iends_with(text, "BIRNEN", unicode_comparer));
+    CHECK(cppstringx::iends_with(std::string("Stra\xC3\x9F" "e"), "\xE1\xBA\x9E" "E", unicode_comparer));
+    CHECK(cppstringx::iends_with(std::u16string(u"x\U00010400"), u"\U00010428", unicode_comparer));
+    CHECK(cppstringx::iends_with(std::string("x\xF0\x90\x90\x80"), U"\U00010428", unicode_comparer));
+    CHECK_FALSE(cppstringx::iends_with(std::string("Stra\xC3\x9F" "e"), "SSE", unicode_comparer));
+    CHECK_FALSE(cppstringx::iends_with(std::string("\xA4"), "\xC3\xA4", unicode_comparer));
+}
+
+TEST_CASE("test unicode comparer contains and replace", "[unicode_case]")
+{
+    // ASCII patterns without k and s use the ASCII search.
+    std::string text(200, 'x');
+    text += "Hello WORLD";
+    CHECK(cppstringx::contains(text, "world", unicode_comparer));
+    CHECK_FALSE(cppstringx::contains(text, "worlds", unicode_comparer));
+    CHECK(cppstringx::contains(text, "HELLO", unicode_comparer));
+    CHECK(cppstringx::contains(text, "", unicode_comparer));
+
+    // The Kelvin sign and the long s fold to ASCII letters.
+    CHECK(cppstringx::contains(std::string("temperature in \xE2\x84\xAA" "elvin"), "KELVIN", unicode_comparer));
+    CHECK(cppstringx::contains(std::string("Gro\xC5\xBF" "e"), "gros", unicode_comparer));
+    CHECK_FALSE(cppstringx::contains(std::string("temperature in \xE2\x84\xAA" "elvin"), "kelvins", unicode_comparer));
+
+    CHECK(cppstringx::contains(std::string("\xCE\x9F\xCE\x94\xCE\xA5\xCE\xA3\xCE\xA3\xCE\x95\xCE\xA5\xCE\xA3"), "\xCF\x83\xCE\xB5\xCF\x85\xCF\x82", unicode_comparer));
+    CHECK(cppstringx::contains(std::u16string(u"ΟΔΥΣΣΕΥΣ"), u"σευς", unicode_comparer));
+    CHECK_FALSE(cppstringx::contains(std::u16string(u"ΟΔΥΣΣΕΥΣ"), u"σευσς", unicode_comparer));
+    CHECK(cppstringx::contains(std::list<char16_t>({ u'Ο', u'Δ', u'Υ' }), u"δυ", unicode_comparer));
+
+    // A match must start and end at code point boundaries.
+    CHECK_FALSE(cppstringx::contains(std::string("\xC3\xA4"), "\xA4", unicode_comparer));
+    CHECK_FALSE(cppstringx::contains(std::string("\xC3\xA4"), "\xC3", unicode_comparer));
+
+    CHECK(cppstringx::replace_all_copy(std::string("Stra\xC3\x9F" "e STRA\xE1\xBA\x9E" "E"), "stra\xC3\x9F" "e", "road", unicode_comparer) == "road road");
+    CHECK(cppstringx::replace_all_copy(std::u16string(u"ΑΒΓ αβγ"), u"αβγ", u"-", unicode_comparer) == u"- -");
+}
+
+TEST_CASE("test unicode case conversion", "[unicode_case]")
+{
+    const cppstringx::utility::unicode_case unicode;
+    CHECK(cppstringx::to_lower_copy(std::string("HELLO \xC3\x84\xC3\x96\xC3\x9C"), unicode) == "hello \xC3\xA4\xC3\xB6\xC3\xBC");
+    CHECK(cppstringx::to_upper_copy(std::string("hello \xC3\xA4\xC3\xB6\xC3\xBC"), unicode) == "HELLO \xC3\x84\xC3\x96\xC3\x9C");
+    CHECK(cppstringx::to_upper_copy(std::u16string(u"οδυσσευς"), unicode) == u"ΟΔΥΣΣΕΥΣ");
+    CHECK(cppstringx::to_lower_copy(std::u32string(U"ПРИВЕТ \U00010400"), unicode) == U"привет \U00010428");
+    CHECK(cppstringx::to_lower_copy(std::u16string(u"\U00010400"), unicode) == u"\U00010428");
+    CHECK(cppstringx::to_upper_copy(std::string("stra\xC3\x9F" "e"), unicode) == "STRA\xC3\x9F" "E");
+
+    // The size of a UTF-8 string can change.
+    CHECK(cppstringx::to_lower_copy(std::string("\xE2\x84\xAA"), unicode) == "k");
+    CHECK(cppstringx::to_upper_copy(std::string("\xC4\xB1"), unicode) == "I");
+    CHECK(cppstringx::to_lower_copy(std::vector<char>({ '\xE2', '\x84', '\xAA', 'A' }), unicode) == std::vector<char>({ 'k', 'a' }));
+
+    // Invalid sequences are copied unchanged.
+    CHECK(cppstringx::to_lower_copy(std::string("A\xC3" "B\xFF"), unicode) == "a\xC3" "b\xFF");
+    CHECK(cppstringx::to_lower_copy(std::u16string(u"A\xDC00" u"B"), unicode) == u"a\xDC00" u"b");
+
+    // In-place the code points are left unchanged if the size would change.
+    std::string text("\xE2\x84\xAA HELLO \xC3\x84");
+    cppstringx::to_lower_in_place(text, unicode);
+    CHECK(text == "\xE2\x84\xAA hello \xC3\xA4");
+    char buffer[] = "stra\xC3\x9F" "e \xC3\xA4";
+    cppstringx::to_upper_in_place(buffer, unicode);
+    CHECK(std::string(buffer) == "STRA\xC3\x9F" "E \xC3\x84");
+    std::list<char16_t> list_text({ u'σ', u'Ω' });
+    cppstringx::to_upper_in_place(list_text, unicode);
+    CHECK(list_text == std::list<char16_t>({ u'Σ', u'Ω' }));
+
+    // A single code unit is converted if it is a code point.
+    const cppstringx::utility::unicode_to_lower_case_converter to_lower;
+    CHECK(to_lower('A') == 'a');
+    CHECK(to_lower('\xC3') == '\xC3');
+    CHECK(to_lower(u'Ω') == u'ω');
+    CHECK(to_lower(U'\U00010400') == U'\U00010428');
+    CHECK(unicode_comparer(u'Σ', U'ς'));
+    CHECK_FALSE(unicode_comparer('\xC3', u'\xC3'));
+}
+
+TEST_CASE("test unicode comparer ascii blocks", "[unicode_case]")
+{
+    // The strings stored in contiguous memory are compared using ASCII blocks, the lists code point by code point.
+    static const char* const parts[] = { "a", "A", "k", "K", "s", "S", "\xC3\x9F", "\xE1\xBA\x9E", "\xE2\x84\xAA", "\xC5\xBF", "\xCF\x83", "\xCE\xA3", "\xCF\x82", "\xC3", "-" };
+    const size_t part_count = sizeof(parts) / sizeof(parts[0]);
+    std::mt19937 random(2023);
+    std::uniform_int_distribution<size_t> part_index(0, part_count - 1);
+    std::uniform_int_distribution<size_t> ascii_run(0, 40);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string lhs;
+        std::string rhs;
+        const size_t count = 1 + part_index(random) % 4;
+        for (size_t j = 0; j < count; ++j)
+        {
+            const std::string run(ascii_run(random), 'x');
+            lhs += run;
+            rhs += run;
+            lhs += parts[part_index(random)];
+            rhs += parts[part_index(random)];
+        }
+        const std::list<char> lhs_list(lhs.begin(), lhs.end());
+        const std::list<char> rhs_list(rhs.begin(), rhs.end());
+        const bool is_equal = cppstringx::iequals(lhs_list, rhs_list, unicode_comparer);
+        CHECK(cppstringx::iequals(lhs, rhs, unicode_comparer) == is_equal);
+        CHECK(cppstringx::iequals(lhs, rhs.c_str(), unicode_comparer) == is_equal);
+        CHECK(cppstringx::istarts_with(lhs, rhs, unicode_comparer) == cppstringx::istarts_with(lhs_list, rhs_list, unicode_comparer));
+        const std::string pattern = rhs.substr(rhs.size() / 2);
+        CHECK(cppstringx::contains(lhs, pattern, unicode_comparer) == cppstringx::contains(lhs_list, pattern, unicode_comparer));
+        std::list<char> lower_list(lhs_list);
+        cppstringx::to_lower_in_place(lower_list, cppstringx::utility::unicode_case());
+        std::string lower(lhs);
+        cppstringx::to_lower_in_place(lower, cppstringx::utility::unicode_case());
+        CHECK(lower == std::string(lower_list.begin(), lower_list.end()));
+    }
+}
+
+TEST_CASE("test unicode comparer search of k and s", "[unicode_case]")
+{
+    // ASCII patterns containing k or s search the ASCII runs using vector instructions and compare the rest code point by code point.
+    static const char* const parts[] = { "k", "K", "s", "S", "\xE2\x84\xAA", "\xC5\xBF", "\xC3\x9F", "\xCF\x83", "\xC3", "-" };
+    static const char* const patterns[] = { "k", "sk", "ks-", "-s", "s-k", "kks" };
+    const size_t part_count = sizeof(parts) / sizeof(parts[0]);
+    std::mt19937 random(2024);
+    std::uniform_int_distribution<size_t> part_index(0, part_count - 1);
+    std::uniform_int_distribution<size_t> ascii_run(0, 300);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string text;
+        const size_t count = part_index(random) % 5;
+        for (size_t j = 0; j < count; ++j)
+        {
+            text += std::string(ascii_run(random), 'x');
+            text += parts[part_index(random)];
+            text += parts[part_index(random)];
+        }
+        text += std::string(ascii_run(random), 'x');
+        const std::list<char> text_list(text.begin(), text.end());
+        for (const char* p_pattern : patterns)
+        {
+            const auto expected = cppstringx::find_first(text_list, p_pattern, unicode_comparer);
+            const std::ptrdiff_t expected_begin = std::distance(text_list.begin(), expected.begin());
+            const std::ptrdiff_t expected_end = std::distance(text_list.begin(), expected.end());
+            const auto found = cppstringx::find_first(text, p_pattern, unicode_comparer);
+            CHECK(found.begin() - text.begin() == expected_begin);
+            CHECK(found.end() - text.begin() == expected_end);
+            const char* p_text = text.c_str();
+            const auto found_null_terminated = cppstringx::find_first(p_text, p_pattern, unicode_comparer);
+            CHECK(found_null_terminated.begin() - p_text == expected_begin);
+            CHECK(found_null_terminated.end() - p_text == expected_end);
+            CHECK(cppstringx::count(text, p_pattern, unicode_comparer) == cppstringx::count(text_list, p_pattern, unicode_comparer));
+        }
+    }
+}
@@ -52,6 +52,105 @@ TEST_CASE("equals_comparer_ignoring_case", "[util]")
 }
 
 
+//-------------------------------------------------------------------------
+// ascii_equals_comparer_ignoring_case
+//-------------------------------------------------------------------------
+TEST_CASE("ascii_equals_comparer_ignoring_case", "[util]")
+{
+    cppstringx::utility::ascii_equals_comparer_ignoring_case comparer;
+    CHECK(comparer('a', 'a'));
+    CHECK(comparer('a', 'A'));
+    CHECK(comparer('Z', 'z'));
+    CHECK(comparer('a', L'A'));
+    CHECK(comparer(u'A', U'a'));
+    CHECK(!comparer(L'a', 'B'));
+    CHECK(!comparer('@', '`'));
+    CHECK(!comparer('[', '{'));
+    CHECK(!comparer('\xC0', '\xE0'));
+    CHECK(!comparer(L'\u00C0', L'\u00E0'));
+    CHECK(comparer.fold('\xC0') == '\xC0');
+
+    for (int value = 0; value < 256; ++value)
+    {
+        char code_unit = static_cast<char>(value);
+        bool is_upper = value >= 'A' && value <= 'Z';
+        CHECK(comparer.fold(code_unit) == (is_upper ? static_cast<char>(value + 32) : code_unit));
+    }
+}
+
+
+//-------------------------------------------------------------------------
+// latin1_equals_comparer_ignoring_case
+//-------------------------------------------------------------------------
+TEST_CASE("latin1_equals_comparer_ignoring_case", "[util]")
+{
+    cppstringx::utility::latin1_equals_comparer_ignoring_case comparer;
+    CHECK(comparer('a', 'A'));
+    CHECK(comparer('\xC0', '\xE0'));
+    CHECK(comparer(L'\u00C0', L'\u00E0'));
+    CHECK(comparer(u'\u00DE', u'\u00FE'));
+    CHECK(!comparer('\xD7', '\xF7')); // multiplication and division sign
+    CHECK(!comparer('\xDF', '\xFF')); // sharp s and y with diaeresis
+    CHECK(!comparer(u'\u0100', u'\u0101')); // outside of the Latin 1 range
+    CHECK(comparer(u'\u0100', u'\u0100'));
+    CHECK(comparer.fold(U'\U0001F600') == U'\U0001F600');
+
+    for (int value = 0; value < 256; ++value)
+    {
+        bool is_upper = (value >= 'A' && value <= 'Z') || (value >= 0xC0 && value <= 0xDE && value != 0xD7);
+        CHECK(comparer.fold(static_cast<char16_t>(value)) == (is_upper ? value + 32 : value));
+        CHECK(comparer.fold(static_cast<char>(value)) == static_cast<char>(is_upper ? value + 32 : value));
+    }
+}
+
+
+//-------------------------------------------------------------------------
+// ctype_cache
+//-------------------------------------------------------------------------
+TEST_CASE("ctype_cache", "[util]")
+{
+    const cppstringx::utility::ctype_cache& cache = cppstringx::utility::ctype_cache::global();
+    CHECK(&cache == &cppstringx::utility::ctype_cache::global());
+    CHECK(cache.get_locale() == std::locale());
+    CHECK(cache.to_lower('A') == 'a');
+    CHECK(cache.to_upper(L'a') == L'A');
+    CHECK(cache.is_space(' '));
+    CHECK(!cache.is_space(L'x'));
+
+    // the cached classes agree with the locale based classes
+    const cppstringx::utility::ctype_cache classic_cache(std::locale::classic());
+    const std::locale classic = std::locale::classic();
+    cppstringx::utility::cached_equals_comparer_ignoring_case cached_comparer(classic_cache);
+    cppstringx::utility::equals_comparer_ignoring_case comparer(classic);
+    cppstringx::utility::cached_is_space cached_space(classic_cache);
+    cppstringx::utility::is_space space(classic);
+    cppstringx::utility::cached_to_lower_case_converter cached_lower(classic_cache);
+    cppstringx::utility::to_lower_case_converter lower(classic);
+    cppstringx::utility::cached_to_upper_case_converter cached_upper(classic_cache);
+    cppstringx::utility::to_upper_case_converter upper(classic);
+    for (int value = 0; value < 256; ++value)
+    {
+        const char code_unit = static_cast<char>(value);
+        const wchar_t wide_code_unit = static_cast<wchar_t>(value);
+        CHECK(cached_lower(code_unit) == lower(code_unit));
+        CHECK(cached_upper(code_unit) == upper(code_unit));
+        CHECK(cached_space(code_unit) == space(code_unit));
+        CHECK(cached_comparer.fold(code_unit) == comparer.fold(code_unit));
+        CHECK(cached_comparer(code_unit, 'a') == comparer(code_unit, 'a'));
+        CHECK(cached_lower(wide_code_unit) == lower(wide_code_unit));
+        CHECK(cached_upper(wide_code_unit) == upper(wide_code_unit));
+        CHECK(cached_space(wide_code_unit) == space(wide_code_unit));
+        CHECK(cached_comparer(wide_code_unit, L'A') == comparer(wide_code_unit, L'A'));
+    }
+    CHECK(cached_lower(static_cast<unsigned char>('Q')) == static_cast<unsigned char>('q'));
+    CHECK(cached_comparer('a', L'A'));
+    CHECK(!cached_comparer(L'a', 'B'));
+
+    cppstringx::utility::cached_equals_comparer_ignoring_case default_comparer;
+    CHECK(default_comparer('a', 'A'));
+    CHECK(cppstringx::utility::cached_is_space()('\t'));
+}
+
 //-------------------------------------------------------------------------
 // null_terminated_string_iterator
 //-------------------------------------------------------------------------
@@ -138,4 +237,52 @@ TEST_CASE("is_any_of", "[util]")
     std::string empty;
     cppstringx::utility::is_any_of<std::string> isanyof2(empty);
     CHECK(!isanyof2('E'));
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------
+// char_class
+//-------------------------------------------------------------------------
+TEST_CASE("char_class", "[util]")
+{
+    cppstringx::utility::char_class charclass("HeloWrd");
+
+    CHECK(charclass('H'));
+    CHECK(charclass('e'));
+    CHECK(charclass('l'));
+    CHECK(charclass('o'));
+    CHECK(charclass('W'));
+    CHECK(charclass('r'));
+    CHECK(charclass('d'));
+    CHECK(!charclass('x'));
+    CHECK(!charclass('h'));
+    CHECK(!charclass('E'));
+    CHECK(charclass(L'H'));
+    CHECK(!charclass(L'\u0148')); // same low byte as 'H'
+
+    cppstringx::utility::char_class empty;
+    CHECK(!empty('E'));
+    CHECK(!empty('\0'));
+    CHECK(!cppstringx::utility::char_class(std::string())('E'));
+
+    cppstringx::utility::char_class wide(std::u32string(U"\u00E9\u0100\U0001F600 \u0100"));
+    CHECK(wide(U'\u00E9'));
+    CHECK(wide('\xE9'));
+    CHECK(wide(u'\u0100'));
+    CHECK(wide(U'\U0001F600'));
+    CHECK(wide(' '));
+    CHECK(!wide(U'\u0101'));
+    CHECK(!wide('\0'));
+
+    // all code unit values compared to is_any_of
+    std::string all_code_units;
+    for (int value = 1; value < 256; value += 3)
+    {
+        all_code_units.push_back(static_cast<char>(value));
+    }
+    cppstringx::utility::char_class every_third(all_code_units);
+    cppstringx::utility::is_any_of<std::string> isanyof(all_code_units);
+    for (int value = 0; value < 256; ++value)
+    {
+        CHECK(every_third(static_cast<char>(value)) == isanyof(static_cast<char>(value)));
+    }
+}